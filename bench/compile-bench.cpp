@@ -0,0 +1,68 @@
+/// @file       bench/compile-bench.cpp
+/// @brief      Cost at compile-time of many distinct statically dimensioned
+///             expressions.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+///
+/// Each of 245 combinations of integer powers of meter, second, and gram is
+/// formed by pow<>, multiplication, and division, and each is squared,
+/// square-rooted, and raised to the power one half.  Every resulting
+/// statdim_base is instantiated with its dimension evaluated at compile-time,
+/// by way of basic_dim::combine(), transform(), and the packed arithmetic on
+/// integer exponents.  The Makefile reports the time taken to compile this
+/// file, and the program reports only the number of expressions and a
+/// checksum.
+
+#include <iostream> // for cout
+#include <utility>  // for integer_sequence
+#include <vnix/units.hpp>
+
+using namespace vnix::units::dbl;
+using vnix::units::pow;
+using std::integer_sequence;
+using std::make_integer_sequence;
+
+
+/// Sum of numbers of several expressions for one combination of powers.
+/// @tparam I  Offset of power of meter.
+/// @tparam J  Offset of power of second.
+/// @tparam K  Offset of power of gram.
+template <int I, int J, int K> double expressions() {
+  auto const q = pow<I - 3>(m) * pow<J - 3>(s) / pow<K - 2>(g);
+  auto const r = (q * q).square_root();
+  auto const h = pow<1, 2>(q);
+  return r.raw_number() + h.raw_number() + (r / q).to_number();
+}
+
+/// Sum over powers of gram.
+template <int I, int J, int... K>
+double sum_k(integer_sequence<int, K...>) {
+  double const a[] = {expressions<I, J, K>()...};
+  double       s   = 0;
+  for (double x : a) { s += x; }
+  return s;
+}
+
+/// Sum over powers of second and of gram.
+template <int I, int... J> double sum_j(integer_sequence<int, J...>) {
+  double const a[] = {sum_k<I, J>(make_integer_sequence<int, 5>())...};
+  double       s   = 0;
+  for (double x : a) { s += x; }
+  return s;
+}
+
+/// Sum over powers of meter, of second, and of gram.
+template <int... I> double sum_i(integer_sequence<int, I...>) {
+  double const a[] = {sum_j<I>(make_integer_sequence<int, 7>())...};
+  double       s   = 0;
+  for (double x : a) { s += x; }
+  return s;
+}
+
+
+int main() {
+  double const sum = sum_i(make_integer_sequence<int, 7>());
+  std::cout << "expressions: " << 7 * 7 * 5 << std::endl;
+  std::cout << "(check: " << sum << ")" << std::endl;
+  return 0;
+}
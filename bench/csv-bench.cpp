@@ -0,0 +1,59 @@
+/// @file       bench/csv-bench.cpp
+/// @brief      Throughput of vnix::units::basic_csv_reader and write_csv.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+///
+/// A synthetic CSV-file of the form "t[s],x[km],F[mN]" is generated in
+/// memory, and then it is read and written.  Throughput is reported in GB/s.
+/// The size of the file in MB may be given as the first argument.
+
+#include <chrono>   // for steady_clock
+#include <cstdlib>  // for atoi
+#include <iostream> // for cout
+#include <random>   // for mt19937
+#include <sstream>  // for istringstream, ostringstream
+#include <vnix/units/csv.hpp>
+
+using namespace vnix::units;
+using clk = std::chrono::steady_clock;
+
+
+/// Seconds elapsed since specified time.
+static double since(clk::time_point t0) {
+  return std::chrono::duration<double>(clk::now() - t0).count();
+}
+
+
+int main(int argc, char **argv) {
+  size_t const mb = (argc > 1 ? std::atoi(argv[1]) : 256);
+
+  std::ostringstream oss;
+  oss << "t[s],x[km],F[mN]\n";
+  std::mt19937                          gen(1);
+  std::uniform_real_distribution<double> x(-1.0E+03, 1.0E+03);
+  for (size_t i = 0; oss.tellp() < std::streamoff(mb << 20); ++i) {
+    oss << i * 1.0E-03 << ',' << x(gen) << ',' << x(gen) << '\n';
+  }
+  std::string const csv = oss.str();
+  double const      gb  = csv.size() * 1.0E-09;
+
+  for (unsigned threads = 1; threads <= std::thread::hardware_concurrency();
+       threads *= 2) {
+    basic_csv_reader<double> const reader(1 << 22, threads);
+    std::istringstream             iss(csv);
+    auto const                     t0 = clk::now();
+    auto const                     t  = reader.read(iss);
+    double const                   dt = since(t0);
+    std::cout << "read  " << t.rows() << " rows, " << threads
+              << " thread(s): " << gb / dt << " GB/s" << std::endl;
+    if (threads * 2 > std::thread::hardware_concurrency()) {
+      std::ostringstream out;
+      auto const         t1 = clk::now();
+      write_csv(out, t, {"s", "km", "mN"});
+      std::cout << "write " << t.rows()
+                << " rows: " << out.tellp() * 1.0E-09 / since(t1) << " GB/s"
+                << std::endl;
+    }
+  }
+  return 0;
+}
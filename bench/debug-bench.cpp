@@ -0,0 +1,103 @@
+/// @file       bench/debug-bench.cpp
+/// @brief      Speed of quantities relative to numbers in a debug-build.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+///
+/// This is built without optimization, as debug-bench, and again with
+/// -DVNIX_UNITS_DEBUG_INLINE, as debug-inline-bench.  A projectile with
+/// quadratic drag is integrated by Euler's method, first on bare numbers, then
+/// on quantities whose dimensions are known at compile-time, and then on
+/// dyndim.  Time per step is reported in nanoseconds, together with the ratio
+/// to the time on numbers.  The number of steps in millions may be given as
+/// the first argument.
+
+#include <chrono>   // for steady_clock
+#include <cmath>    // for sqrt
+#include <cstdlib>  // for atoi
+#include <iostream> // for cout
+#include <vnix/units.hpp>
+
+using namespace vnix::units;
+using clk = std::chrono::steady_clock;
+
+
+/// Seconds elapsed since specified time.
+static double since(clk::time_point t0) {
+  return std::chrono::duration<double>(clk::now() - t0).count();
+}
+
+
+/// Integrate on bare numbers.
+/// @param n  Number of steps.
+/// @return   Sum of final coordinates in meters.
+static double raw(size_t n) {
+  double       x = 0, y = 0, vx = 30, vy = 40;
+  double const g = 9.8, k = 0.01, dt = 1.0E-06;
+  for (size_t i = 0; i < n; ++i) {
+    double const sp = std::sqrt(vx * vx + vy * vy);
+    double const ax = -k * sp * vx;
+    double const ay = -g - k * sp * vy;
+    vx += ax * dt;
+    vy += ay * dt;
+    x += vx * dt;
+    y += vy * dt;
+  }
+  return x + y;
+}
+
+
+/// Integrate on quantities.
+/// @tparam L  Type of position.
+/// @tparam V  Type of velocity.
+/// @tparam A  Type of acceleration.
+/// @tparam K  Type of coefficient of quadratic drag.
+/// @tparam T  Type of time-step.
+/// @param  n  Number of steps.
+/// @return    Sum of final coordinates in meters.
+template <typename L, typename V, typename A, typename K, typename T>
+static double qty(size_t n) {
+  using namespace dbl;
+  L       x = 0.0 * m, y = 0.0 * m;
+  V       vx = 30.0 * m / s, vy = 40.0 * m / s;
+  A const g  = 9.8 * m / s / s;
+  K const k  = 0.01 / m;
+  T const dt = 1.0E-06 * s;
+  for (size_t i = 0; i < n; ++i) {
+    V const sp = sqrt(vx * vx + vy * vy);
+    A const ax = k * sp * vx * -1.0;
+    A const ay = g * -1.0 - k * sp * vy;
+    vx += ax * dt;
+    vy += ay * dt;
+    x += vx * dt;
+    y += vy * dt;
+  }
+  return ((x + y) / m).to_number();
+}
+
+
+int main(int argc, char **argv) {
+  using namespace dbl;
+  size_t const n  = (argc > 1 ? std::atoi(argv[1]) : 4) * size_t(1000000);
+  double const ns = 1.0E+09 / n;
+
+  auto         t0 = clk::now();
+  double const r  = raw(n);
+  double const tr = since(t0);
+  std::cout << "numbers: " << tr * ns << " ns" << std::endl;
+
+  using recip = decltype(1.0 / m);
+  t0             = clk::now();
+  double const q  = qty<length, speed, acceleration, recip, dbl::time>(n);
+  double const tq = since(t0);
+  std::cout << "statdim: " << tq * ns << " ns (" << tq / tr << "x)"
+            << std::endl;
+
+  t0             = clk::now();
+  double const d = qty<dyndim, dyndim, dyndim, dyndim, dyndim>(n);
+  double const td = since(t0);
+  std::cout << "dyndim:  " << td * ns << " ns (" << td / tr << "x)"
+            << std::endl;
+
+  std::cout << "(check: " << (r - q) + (r - d) << ")" << std::endl;
+  return 0;
+}
@@ -0,0 +1,126 @@
+/// @file       bench/dim-bench.cpp
+/// @brief      Cost of operations on dim for 32-bit and 128-bit encodings.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+///
+/// The dim generated from units.yml (five bases, six-bit exponents, 32-bit
+/// word) is compared with a dim of nine bases and eight-bit exponents
+/// (128-bit word).  For each, the time per operation is reported in
+/// nanoseconds for equality, hashing, packed addition and subtraction, and
+/// addition of each exponent separately.
+
+#include <chrono>   // for steady_clock
+#include <iostream> // for cout
+#include <random>   // for mt19937
+#include <vector>   // for vector
+#include <vnix/units/dim.hpp>
+
+using namespace vnix::units;
+using clk = std::chrono::steady_clock;
+
+
+/// Seconds elapsed since specified time.
+static double since(clk::time_point t0) {
+  return std::chrono::duration<double>(clk::now() - t0).count();
+}
+
+
+/// Basis of nine dimensions, with eight bits per exponent.
+struct wide_dim_base_off {
+  /// C-style enumeration of offsets.
+  enum off : uint_fast8_t { m, kg, s, A, K, mol, cd, rad, bit };
+
+  off offset; ///< Allow declaration of meaningful instance.
+
+  /// Automatically convert instance to type of enum.
+  constexpr operator off() const { return offset; }
+
+  /// Allow construction of constant-expression instance.
+  constexpr wide_dim_base_off(off os) : offset(os) {}
+
+  constexpr static uint_fast8_t num_offs = 9; ///< Number of offsets.
+  constexpr static unsigned     nmr_bits = 6; ///< Bits for numerator.
+  constexpr static unsigned     dnm_bits = 2; ///< Bits for denominator.
+
+  /// Array of enumerated offsets for iterating.
+  constexpr static off const array[num_offs] = {m,   kg, s,   A,  K,
+                                                mol, cd, rad, bit};
+
+  /// Array of basis-dimension symbols, one for each offset.
+  constexpr static char const *const sym[num_offs] = {
+      "m", "kg", "s", "A", "K", "mol", "cd", "rad", "bit"};
+};
+
+constexpr wide_dim_base_off::off const wide_dim_base_off::array[];
+constexpr char const *const            wide_dim_base_off::sym[];
+
+
+/// Time each operation on array of random dims with integer exponents.
+/// @tparam D     Type of dim.
+/// @param  name  Name of dim for report.
+template <typename D> void run(char const *name) {
+  enum { N = 4096, REPS = 2000 };
+  std::mt19937                       gen(1);
+  std::uniform_int_distribution<int> e(-3, 3);
+  std::vector<D>                     x(N), y(N), z(N);
+  std::hash<D> const                 hash;
+  for (unsigned i = 0; i < N; ++i) {
+    typename D::word wx = 0, wy = 0;
+    for (auto b : D::off::array) {
+      D dx(wx), dy(wy);
+      dx.set(b, e(gen));
+      dy.set(b, e(gen));
+      wx = dx.encode();
+      wy = dy.encode();
+    }
+    x[i] = D(wx);
+    y[i] = D(i % 3 ? wy : wx);
+  }
+  double const ops = double(N) * REPS * 1.0E-09;
+  size_t       chk = 0;
+
+  auto t = clk::now();
+  for (unsigned r = 0; r < REPS; ++r) {
+    for (unsigned i = 0; i < N; ++i) { chk += (x[i] == y[i]); }
+  }
+  double const eq = since(t) / ops;
+
+  t = clk::now();
+  for (unsigned r = 0; r < REPS; ++r) {
+    for (unsigned i = 0; i < N; ++i) { chk += hash(x[i]) + r; }
+  }
+  double const hs = since(t) / ops;
+
+  t = clk::now();
+  for (unsigned r = 0; r < REPS; ++r) {
+    for (unsigned i = 0; i < N; ++i) { z[i] = x[i] + y[i]; }
+    chk += hash(z[r % N]);
+  }
+  double const add = since(t) / ops;
+
+  t = clk::now();
+  for (unsigned r = 0; r < REPS; ++r) {
+    for (unsigned i = 0; i < N; ++i) { z[i] = x[i] - y[i]; }
+    chk += hash(z[r % N]);
+  }
+  double const sub = since(t) / ops;
+
+  t = clk::now();
+  for (unsigned r = 0; r < REPS / 20; ++r) {
+    for (unsigned i = 0; i < N; ++i) { z[i] = x[i].combine(y[i], D::add); }
+    chk += hash(z[r % N]);
+  }
+  double const slow = since(t) / ops * 20;
+
+  std::cout << name << " (" << 8 * sizeof(typename D::word)
+            << "-bit): == " << eq << " ns, hash " << hs << " ns, + " << add
+            << " ns, - " << sub << " ns, + by exponent " << slow
+            << " ns (check " << chk % 10 << ")" << std::endl;
+}
+
+
+int main() {
+  run<dim>("dim");
+  run<basic_dim<wide_dim_base_off>>("wide dim");
+  return 0;
+}
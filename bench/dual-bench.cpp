@@ -0,0 +1,68 @@
+/// @file       bench/dual-bench.cpp
+/// @brief      Throughput of vnix::units::basic_dual_batch.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+///
+/// Kinetic energy and its derivatives with respect to mass and to speed are
+/// computed, first element by element as dimval<dual<double, 2>>, and then by
+/// multiplying, in place, a whole basic_dual_batch.  Time per element is
+/// reported in nanoseconds.  The number of elements in millions may be given
+/// as the first argument.
+
+#include <chrono>   // for steady_clock
+#include <cstdlib>  // for atoi
+#include <iostream> // for cout
+#include <random>   // for mt19937
+#include <vnix/units.hpp>
+#include <vnix/units/dual.hpp>
+
+using namespace vnix::units;
+using clk = std::chrono::steady_clock;
+
+
+/// Seconds elapsed since specified time.
+static double since(clk::time_point t0) {
+  return std::chrono::duration<double>(clk::now() - t0).count();
+}
+
+
+int main(int argc, char **argv) {
+  using namespace dbl;
+  size_t const n = (argc > 1 ? std::atoi(argv[1]) : 2) * size_t(1000000);
+  std::mt19937                           gen(1);
+  std::uniform_real_distribution<double> u(1, 2);
+  basic_dual_batch<double, 2> ms(n, mass_dim), v(n, speed::d());
+  for (size_t i = 0; i < n; ++i) {
+    ms.values()[i] = u(gen) * kg.raw_number();
+    v.values()[i]  = u(gen);
+  }
+  ms.seed(0);
+  v.seed(1);
+  double const ns = 1.0E+09 / n;
+
+  auto const    m0 = independent<2>(kg, 0);
+  auto const    v0 = independent<2>(m / s, 1);
+  using denergy    = decltype(0.5 * m0 * v0 * v0);
+  std::vector<denergy> e;
+  e.reserve(n);
+  auto t0 = clk::now();
+  for (size_t i = 0; i < n; ++i) {
+    auto const mi = independent<2>(ms.values()[i] * g, 0);
+    auto const vi = independent<2>(v.values()[i] * m / s, 1);
+    e.push_back(0.5 * mi * vi * vi);
+  }
+  std::cout << "each dimval: " << since(t0) * ns << " ns" << std::endl;
+
+  auto b = ms; // Mass to be multiplied in place.
+  t0     = clk::now();
+  b *= v;
+  b *= v;
+  std::cout << "dual batch:  " << since(t0) * ns << " ns" << std::endl;
+
+  double sum = 0;
+  for (size_t i = 0; i < n; i += 4096) {
+    sum += e[i].raw_number().g[1] - 0.5 * b.derivatives(1)[i];
+  }
+  std::cout << "(check: " << sum << ")" << std::endl;
+  return 0;
+}
@@ -0,0 +1,63 @@
+/// @file       bench/histogram-bench.cpp
+/// @brief      Throughput of vnix::units::basic_histogram.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+///
+/// Random speeds are counted into uniform bins and into bins with arbitrary
+/// edges, by a single thread and by every hardware-thread, and compared with
+/// a loop that checks the dimension of each quantity.  Time per element is
+/// reported in nanoseconds.  The number of elements in millions may be given
+/// as the first argument.
+
+#include <chrono>   // for steady_clock
+#include <cstdlib>  // for atoi
+#include <iostream> // for cout
+#include <random>   // for mt19937
+#include <vnix/units.hpp>
+#include <vnix/units/histogram.hpp>
+
+using namespace vnix::units;
+using clk = std::chrono::steady_clock;
+
+
+/// Seconds elapsed since specified time.
+static double since(clk::time_point t0) {
+  return std::chrono::duration<double>(clk::now() - t0).count();
+}
+
+
+int main(int argc, char **argv) {
+  using namespace flt;
+  size_t const n = (argc > 1 ? std::atoi(argv[1]) : 16) * size_t(1000000);
+  std::mt19937                          gen(1);
+  std::normal_distribution<float>       u(300, 100);
+  std::vector<float>                    x(n);
+  for (auto &e : x) { e = u(gen); }
+  statdim_span<speed::d().encode(), float const> sp(x.data(), n);
+  double const                                   ns = 1.0E+09 / n;
+
+  histogram<speed> h(0 * m / s, 600 * m / s, 60);
+  auto             t0 = clk::now();
+  for (size_t i = 0; i < n; ++i) {
+    dyndim const v = sp[i];  // Dimension checked on each conversion.
+    h.add(v);
+  }
+  std::cout << "add each dyndim:     " << since(t0) * ns << " ns" << std::endl;
+
+  std::vector<speed> edges;
+  for (int i = 0; i <= 60; ++i) { edges.push_back(i * i / 6.0f * m / s); }
+  histogram<speed> e(edges);
+  unsigned const   hw = std::thread::hardware_concurrency();
+  for (unsigned th : {1u, hw}) {
+    h.clear();
+    t0 = clk::now();
+    h.fill(sp, th);
+    std::cout << "uniform, " << th << " thread(s): " << since(t0) * ns << " ns"
+              << std::endl;
+    t0 = clk::now();
+    e.fill(sp, th);
+    std::cout << "edges,   " << th << " thread(s): " << since(t0) * ns << " ns"
+              << std::endl;
+  }
+  return 0;
+}
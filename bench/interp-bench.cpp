@@ -0,0 +1,68 @@
+/// @file       bench/interp-bench.cpp
+/// @brief      Throughput of vnix::units::basic_interp.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+///
+/// Random altitudes are looked up in a table of pressure against altitude,
+/// with uniform and with non-uniform abscissae, by linear and by monotone
+/// cubic interpolation, one quantity at a time and in batch over a span.
+/// Time per element is reported in nanoseconds.  The number of elements in
+/// millions may be given as the first argument.
+
+#include <chrono>   // for steady_clock
+#include <cmath>    // for exp
+#include <cstdlib>  // for atoi
+#include <iostream> // for cout
+#include <random>   // for mt19937
+#include <vnix/units.hpp>
+#include <vnix/units/interp.hpp>
+
+using namespace vnix::units;
+using clk = std::chrono::steady_clock;
+
+
+/// Seconds elapsed since specified time.
+static double since(clk::time_point t0) {
+  return std::chrono::duration<double>(clk::now() - t0).count();
+}
+
+
+int main(int argc, char **argv) {
+  using namespace dbl;
+  size_t const n = (argc > 1 ? std::atoi(argv[1]) : 4) * size_t(1000000);
+  std::mt19937                           gen(1);
+  std::uniform_real_distribution<double> u(0, 30000);
+  std::vector<double>                    x(n), y(n);
+  for (auto &e : x) { e = u(gen); }
+  statdim_span<length::d().encode(), double const> xs(x.data(), n);
+  statdim_span<pressure::d().encode(), double>     ys(y.data(), n);
+  double const                                     ns = 1.0E+09 / n;
+
+  auto const Pa = N / m / m;
+  for (bool const uni : {true, false}) {
+    std::vector<length>   alt;
+    std::vector<pressure> prs;
+    for (int i = 0; i <= 64; ++i) {
+      double const h = (uni ? i / 64.0 : i * i / 4096.0) * 30000;
+      alt.push_back(h * m);
+      prs.push_back(101325 * std::exp(-h / 8500) * Pa);
+    }
+    for (auto method : {interp_method::linear, interp_method::monotone_cubic}) {
+      interp<length, pressure> const p(alt, prs, method);
+      char const *const              name =
+          (method == interp_method::linear ? "linear" : "cubic ");
+      double sum = 0;
+      auto   t0  = clk::now();
+      for (size_t i = 0; i < n; ++i) { sum += p(xs[i]).raw_number(); }
+      double const t1 = since(t0) * ns;
+      t0              = clk::now();
+      p(xs, ys);
+      double const t2 = since(t0) * ns;
+      for (size_t i = 0; i < n; i += n / 4) { sum += y[i]; }
+      std::cout << (uni ? "uniform, " : "ragged,  ") << name
+                << ": each " << t1 << " ns, batch " << t2 << " ns"
+                << (sum == 0 ? " " : "") << std::endl;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,63 @@
+/// @file       bench/interval-bench.cpp
+/// @brief      Throughput of vnix::units::basic_interval_batch.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+///
+/// Bounds on speed are computed from bounds on distance and on time, first
+/// element by element as dimval<interval<double>>, and then by dividing, in
+/// place, a whole basic_interval_batch.  Time per element is reported in
+/// nanoseconds.  The number of elements in millions may be given as the first
+/// argument.
+
+#include <chrono>   // for steady_clock
+#include <cstdlib>  // for atoi
+#include <iostream> // for cout
+#include <random>   // for mt19937
+#include <vnix/units.hpp>
+#include <vnix/units/interval.hpp>
+
+using namespace vnix::units;
+using clk = std::chrono::steady_clock;
+
+
+/// Seconds elapsed since specified time.
+static double since(clk::time_point t0) {
+  return std::chrono::duration<double>(clk::now() - t0).count();
+}
+
+
+int main(int argc, char **argv) {
+  using namespace dbl;
+  size_t const n = (argc > 1 ? std::atoi(argv[1]) : 4) * size_t(1000000);
+  std::mt19937                           gen(1);
+  std::uniform_real_distribution<double> u(1, 2);
+  basic_interval_batch<double>           x(n, length_dim), t(n, time_dim);
+  for (size_t i = 0; i < n; ++i) {
+    double const a = u(gen), b = u(gen);
+    x.set(i, between(a * m, (a + 0.01) * m));
+    t.set(i, between(b * s, (b + 0.01) * s));
+  }
+  double const ns = 1.0E+09 / n;
+
+  using ispeed = decltype(between(m, m) / between(s, s));
+  std::vector<ispeed> v;
+  v.reserve(n);
+  auto t0 = clk::now();
+  for (size_t i = 0; i < n; ++i) {
+    v.push_back(between(x.lowers()[i] * m, x.uppers()[i] * m) /
+                between(t.lowers()[i] * s, t.uppers()[i] * s));
+  }
+  std::cout << "each dimval:    " << since(t0) * ns << " ns" << std::endl;
+
+  auto b = x; // Numerator to be divided in place.
+  t0     = clk::now();
+  b /= t;
+  std::cout << "interval batch: " << since(t0) * ns << " ns" << std::endl;
+
+  double sum = 0;
+  for (size_t i = 0; i < n; i += 4096) {
+    sum += (upper(v[i]) / (m / s)).to_number() - b.uppers()[i];
+  }
+  std::cout << "(check: " << sum << ")" << std::endl;
+  return 0;
+}
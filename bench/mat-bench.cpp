@@ -0,0 +1,94 @@
+/// @file       bench/mat-bench.cpp
+/// @brief      Throughput of vnix::mv::mat.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+///
+/// Products and inverses of small matrices of quantities are compared with
+/// the same operations on matrices of bare numbers, and with the naive
+/// triple loop that vnix::mv::mat replaces.  Time per operation is reported
+/// in nanoseconds.  The number of operations in millions may be given as the
+/// first argument.
+
+#include <chrono>   // for steady_clock
+#include <cstdlib>  // for atoi
+#include <iostream> // for cout
+#include <random>   // for mt19937
+#include <vector>   // for vector
+#include <vnix/mv/mat.hpp>
+#include <vnix/units.hpp>
+
+using namespace vnix::mv;
+using clk = std::chrono::steady_clock;
+
+
+/// Seconds elapsed since specified time.
+static double since(clk::time_point t0) {
+  return std::chrono::duration<double>(clk::now() - t0).count();
+}
+
+
+/// Naive product by dot-product of each row with each column.
+template <typename T1, typename T2, size_t NR1, size_t NC2, size_t N>
+static auto naive(mat<T1, NR1, N> const &m1, mat<T2, N, NC2> const &m2) {
+  using TT = decltype(dot(m1.row(0), m2.col(0)));
+  mat<std::remove_const_t<TT>, NR1, NC2> pr;
+  for (size_t i = 0; i < NR1; ++i) {
+    for (size_t j = 0; j < NC2; ++j) { pr(i, j) = dot(m1.row(i), m2.col(j)); }
+  }
+  return pr;
+}
+
+
+/// Time product and inverse of N x N matrices of type T.
+template <typename T, size_t N>
+static void run(char const *name, std::vector<mat<T, N, N>> const &m,
+                size_t n) {
+  double const ns = 1.0E+09 / n;
+  size_t const k  = m.size() - 1; // Mask for power of two.
+  using P         = decltype(m[0] * m[0]);
+  using I         = decltype(inverse(m[0]));
+  std::vector<P> p(k + 1);
+  std::vector<I> x(k + 1);
+  auto           t0 = clk::now();
+  for (size_t i = 0; i < n; ++i) {
+    p[i & k] = naive(m[i & k], m[(i + 1) & k]);
+  }
+  double const tn = since(t0) * ns;
+  t0              = clk::now();
+  for (size_t i = 0; i < n; ++i) { p[i & k] = m[i & k] * m[(i + 1) & k]; }
+  double const tp = since(t0) * ns;
+  t0              = clk::now();
+  for (size_t i = 0; i < n; ++i) { x[i & k] = inverse(m[i & k]); }
+  double const ti = since(t0) * ns;
+  std::cout << name << ": naive " << tn << " ns, product " << tp
+            << " ns, inverse " << ti << " ns" << (p[0] == p[1] ? " " : "")
+            << (x[0] == x[1] ? " " : "") << std::endl;
+}
+
+
+/// Random N x N matrices of type T, whose elements are multiples of unit u.
+template <typename T, size_t N, typename U>
+static std::vector<mat<T, N, N>> random(std::mt19937 &gen, U const &u) {
+  std::uniform_real_distribution<double> r(-1, 1);
+  std::vector<mat<T, N, N>>              v(64);
+  for (auto &m : v) {
+    for (size_t i = 0; i < N; ++i) {
+      for (size_t j = 0; j < N; ++j) { m(i, j) = (r(gen) + (i == j) * N) * u; }
+    }
+  }
+  return v;
+}
+
+
+int main(int argc, char **argv) {
+  using namespace vnix::units::dbl;
+  size_t const n = (argc > 1 ? std::atoi(argv[1]) : 4) * size_t(1000000);
+  std::mt19937 gen(1);
+  run("3x3 double", random<double, 3>(gen, 1.0), n);
+  run("3x3 length", random<length, 3>(gen, m), n);
+  run("4x4 double", random<double, 4>(gen, 1.0), n);
+  run("4x4 length", random<length, 4>(gen, m), n);
+  run("6x6 double", random<double, 6>(gen, 1.0), n);
+  run("6x6 length", random<length, 6>(gen, m), n);
+  return 0;
+}
@@ -0,0 +1,129 @@
+/// @file       bench/rat-bench.cpp
+/// @brief      Throughput of vnix::gcd and of arithmetic on arrays of
+///             vnix::rat::rational.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+///
+/// First, vnix::gcd, by Stein's binary algorithm, is compared with Euclid's
+/// algorithm on random pairs of 16-bit and of 64-bit numbers.  Then, for each
+/// of rat8_t, rat16_t, rat32_t, and rat64_t, random rationals are added and
+/// multiplied, element by element, first by the operator, converted back to
+/// the type of each operand, and then by vnix::rat::add and
+/// vnix::rat::multiply; and the elements are summed, first by operator+= and
+/// then by vnix::rat::sum.  Time per element is reported in nanoseconds.  The
+/// number of elements in millions may be given as the first argument.
+
+#include <chrono>   // for steady_clock
+#include <cstdint>  // for uint64_t
+#include <cstdlib>  // for atoi
+#include <iostream> // for cout
+#include <random>   // for mt19937
+#include <vector>   // for vector
+#include <vnix/rat.hpp>
+#include <vnix/rat/batch.hpp>
+
+using namespace vnix;
+using clk = std::chrono::steady_clock;
+
+
+/// Seconds elapsed since specified time.
+static double since(clk::time_point t0) {
+  return std::chrono::duration<double>(clk::now() - t0).count();
+}
+
+
+/// Greatest common divisor by Euclid's algorithm, for comparison.
+static uint64_t euclid(uint64_t a, uint64_t b) {
+  while (b != 0) {
+    uint64_t const r = a % b;
+    a                = b;
+    b                = r;
+  }
+  return a;
+}
+
+
+/// Compare gcd with Euclid's algorithm on random numbers of specified width.
+/// @param n     Number of pairs.
+/// @param bits  Number of bits in each number.
+static void bench_gcd(size_t n, unsigned bits) {
+  std::mt19937_64         gen(1);
+  std::vector<uint64_t>   a(n), b(n);
+  uint64_t const          mask = (bits < 64 ? (uint64_t(1) << bits) : 0) - 1;
+  for (size_t i = 0; i < n; ++i) {
+    a[i] = gen() & mask;
+    b[i] = gen() & mask;
+  }
+  double const ns = 1.0E+09 / n;
+  uint64_t     s1 = 0, s2 = 0;
+  auto         t0 = clk::now();
+  for (size_t i = 0; i < n; ++i) { s1 += euclid(a[i], b[i]); }
+  double const te = since(t0);
+  t0              = clk::now();
+  for (size_t i = 0; i < n; ++i) { s2 += gcd(a[i], b[i]); }
+  double const tb = since(t0);
+  std::cout << "gcd " << bits << "-bit: euclid " << te * ns << " ns, binary "
+            << tb * ns << " ns (check: " << s1 - s2 << ")" << std::endl;
+}
+
+
+/// Compare operators with operations on arrays.
+/// @tparam R     Type of rational.
+/// @param  name  Name of type.
+/// @param  n     Number of elements.
+template <typename R> static void bench_rat(char const *name, size_t n) {
+  // Numerator and denominator are small enough that every sum and every
+  // product of two elements fit in R.
+  enum { NMAX = 1 << (R::BITS / 5), DMAX = 1 << (R::BITS / 8) };
+  std::mt19937                       gen(1);
+  std::uniform_int_distribution<int> un(-NMAX, NMAX), ud(1, DMAX);
+  std::vector<R>                     a(n), b(n), r1(n), r2(n);
+  for (size_t i = 0; i < n; ++i) {
+    a[i] = R(un(gen), ud(gen));
+    b[i] = R(un(gen), ud(gen));
+  }
+  double const ns = 1.0E+09 / n;
+  auto         t0 = clk::now();
+  for (size_t i = 0; i < n; ++i) { r1[i] = R(a[i] + b[i]); }
+  double const to_add = since(t0);
+  t0                  = clk::now();
+  rat::add(a.data(), b.data(), r2.data(), n);
+  double const tb_add = since(t0);
+  bool         ok     = (r1 == r2);
+
+  t0 = clk::now();
+  for (size_t i = 0; i < n; ++i) { r1[i] = R(a[i] * b[i]); }
+  double const to_mul = since(t0);
+  t0                  = clk::now();
+  rat::multiply(a.data(), b.data(), r2.data(), n);
+  double const tb_mul = since(t0);
+  ok                  = ok && (r1 == r2);
+
+  // Alternate signs, so that the partial sums stay small.
+  for (size_t i = 1; i < n; i += 2) { a[i] = -a[i - 1]; }
+  t0 = clk::now();
+  R s1;
+  for (size_t i = 0; i < n; ++i) { s1 += a[i]; }
+  double const to_sum = since(t0);
+  t0                  = clk::now();
+  R const      s2     = rat::sum(a.data(), n);
+  double const tb_sum = since(t0);
+  ok                  = ok && (s1 == s2);
+
+  std::cout << name << ": add " << to_add * ns << " -> " << tb_add * ns
+            << " ns, multiply " << to_mul * ns << " -> " << tb_mul * ns
+            << " ns, sum " << to_sum * ns << " -> " << tb_sum * ns << " ns"
+            << (ok ? "" : " (MISMATCH)") << std::endl;
+}
+
+
+int main(int argc, char **argv) {
+  size_t const n = (argc > 1 ? std::atoi(argv[1]) : 1) * size_t(1000000);
+  bench_gcd(n, 16);
+  bench_gcd(n, 64);
+  bench_rat<rat8_t>("rat8_t ", n);
+  bench_rat<rat16_t>("rat16_t", n);
+  bench_rat<rat32_t>("rat32_t", n);
+  bench_rat<rat64_t>("rat64_t", n);
+  return 0;
+}
@@ -0,0 +1,67 @@
+/// @file       bench/registry-bench.cpp
+/// @brief      Start-up and look-up time of vnix::units::unit_registry.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+///
+/// The file ../units.yml, or the file named by the first argument, is read
+/// into memory and then loaded into a registry repeatedly.  Time to load is
+/// reported in microseconds, and time to look up a symbol in nanoseconds,
+/// alongside that of the linear scan in find_unit_sym().
+
+#include <chrono>   // for steady_clock
+#include <fstream>  // for ifstream
+#include <iostream> // for cout
+#include <sstream>  // for istringstream, ostringstream
+#include <vnix/units/registry.hpp>
+
+using namespace vnix::units;
+using clk = std::chrono::steady_clock;
+
+
+/// Seconds elapsed since specified time.
+static double since(clk::time_point t0) {
+  return std::chrono::duration<double>(clk::now() - t0).count();
+}
+
+
+int main(int argc, char **argv) {
+  std::ifstream ifs(argc > 1 ? argv[1] : "../units.yml");
+  if (!ifs) {
+    std::cerr << "cannot open units.yml" << std::endl;
+    return 1;
+  }
+  std::ostringstream oss;
+  oss << ifs.rdbuf();
+  std::string const yml = oss.str();
+
+  unsigned const loads = 1000;
+  size_t         units = 0;
+  auto const     t0    = clk::now();
+  for (unsigned i = 0; i < loads; ++i) {
+    std::istringstream is(yml);
+    units += unit_registry(is).num_units();
+  }
+  double const dt0 = since(t0) / loads * 1.0E+06;
+  std::cout << "load " << units / loads << " units: " << dt0 << " us"
+            << std::endl;
+
+  std::istringstream  is(yml);
+  unit_registry const r(is);
+  unsigned const      looks = 1000000;
+  long double         sum   = 0;
+  auto const          t1    = clk::now();
+  for (unsigned i = 0; i < looks; ++i) {
+    unit_sym const &s = unit_syms[i % num_unit_syms];
+    sum += r.find_unit(s.sym)->sf;
+  }
+  double const dt1 = since(t1) / looks * 1.0E+09;
+  auto const   t2  = clk::now();
+  for (unsigned i = 0; i < looks; ++i) {
+    unit_sym const &s = unit_syms[i % num_unit_syms];
+    sum -= find_unit_sym(s.sym, std::strlen(s.sym))->sf;
+  }
+  double const dt2 = since(t2) / looks * 1.0E+09;
+  std::cout << "lookup registry: " << dt1 << " ns, unit_syms: " << dt2
+            << " ns (check " << double(sum) << ")" << std::endl;
+  return 0;
+}
@@ -0,0 +1,72 @@
+/// @file       bench/sort-bench.cpp
+/// @brief      Throughput of sorting quantities.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+///
+/// Random lengths are sorted (1) by std::sort on a vector of dyndim, which
+/// checks dimensions on every comparison, (2) by std::sort on bare numbers,
+/// (3) by sort() on a vector of dyndim, (4) by radix-sort on a span, and (5)
+/// by parallel_sort() on a span.  Time per element is reported in
+/// nanoseconds.  The number of elements in millions may be given as the first
+/// argument.
+
+#include <chrono>   // for steady_clock
+#include <cstdlib>  // for atoi
+#include <iostream> // for cout
+#include <random>   // for mt19937
+#include <vnix/units.hpp>
+#include <vnix/units/sort.hpp>
+
+using namespace vnix::units;
+using clk = std::chrono::steady_clock;
+
+
+/// Seconds elapsed since specified time.
+static double since(clk::time_point t0) {
+  return std::chrono::duration<double>(clk::now() - t0).count();
+}
+
+
+int main(int argc, char **argv) {
+  size_t const n = (argc > 1 ? std::atoi(argv[1]) : 4) * size_t(1000000);
+  std::mt19937                           gen(1);
+  std::uniform_real_distribution<double> u(-1.0E+06, 1.0E+06);
+  std::vector<double>                    x(n);
+  for (auto &e : x) { e = u(gen); }
+  std::vector<dbl::dyndim> v;
+  for (auto e : x) { v.push_back(e * dbl::m); }
+  double const ns = 1.0E+09 / n;
+
+  auto w  = v;
+  auto t0 = clk::now();
+  std::sort(w.begin(), w.end());
+  std::cout << "std::sort on dyndims:   " << since(t0) * ns << " ns"
+            << std::endl;
+
+  auto y = x;
+  t0     = clk::now();
+  std::sort(y.begin(), y.end());
+  std::cout << "std::sort on numbers:   " << since(t0) * ns << " ns"
+            << std::endl;
+
+  w  = v;
+  t0 = clk::now();
+  sort(w);
+  std::cout << "sort on dyndims:        " << since(t0) * ns << " ns"
+            << std::endl;
+
+  y  = x;
+  t0 = clk::now();
+  sort(dyndim_span<double>(y.data(), n, length_dim));
+  std::cout << "radix-sort on span:     " << since(t0) * ns << " ns"
+            << std::endl;
+
+  for (unsigned th = 2; th <= std::thread::hardware_concurrency(); th *= 2) {
+    y  = x;
+    t0 = clk::now();
+    parallel_sort(dyndim_span<double>(y.data(), n, length_dim), th);
+    std::cout << "parallel_sort, " << th << " threads: " << since(t0) * ns
+              << " ns" << std::endl;
+  }
+  return 0;
+}
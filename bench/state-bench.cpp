@@ -0,0 +1,60 @@
+/// @file       bench/state-bench.cpp
+/// @brief      Throughput of vnix::units::basic_state_mat.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+///
+/// The prediction of the covariance of a Kalman filter with three lengths and
+/// three speeds, F P F^T + Q, is timed with dimensioned state-matrices and
+/// with bare matrices of numbers.  Time per prediction is reported in
+/// nanoseconds.  The number of predictions in millions may be given as the
+/// first argument.
+
+#include <chrono>   // for steady_clock
+#include <cstdlib>  // for atoi
+#include <iostream> // for cout
+#include <vnix/units.hpp>
+#include <vnix/units/state.hpp>
+
+using namespace vnix::units;
+using clk = std::chrono::steady_clock;
+
+
+/// Seconds elapsed since specified time.
+static double since(clk::time_point t0) {
+  return std::chrono::duration<double>(clk::now() - t0).count();
+}
+
+
+int main(int argc, char **argv) {
+  using namespace dbl;
+  using st  = state_vec<length, length, length, speed, speed, speed>;
+  using cov = covariance<st>;
+  using raw = vnix::mv::mat<double, 6, 6>;
+  size_t const n = (argc > 1 ? std::atoi(argv[1]) : 1) * size_t(1000000);
+  double const ns = 1.0E+09 / n;
+
+  state_map<st, st> f = state_map<st, st>::identity();
+  f.set<0, 3>(0.01 * s);
+  f.set<1, 4>(0.01 * s);
+  f.set<2, 5>(0.01 * s);
+  cov q = cov::zero();
+  for (size_t i = 0; i < 6; ++i) { q.raw()(i, i) = 1.0E-06; }
+  cov p = q;
+
+  auto t0 = clk::now();
+  for (size_t i = 0; i < n; ++i) { p = f * p * transpose(f) + q; }
+  double const td = since(t0) * ns;
+
+  raw const fr = f.raw(), qr = q.raw();
+  raw       pr = qr;
+  t0           = clk::now();
+  for (size_t i = 0; i < n; ++i) {
+    pr = fr * pr * vnix::mv::transpose(fr) + qr;
+  }
+  double const tr = since(t0) * ns;
+
+  std::cout << "dimensioned: " << td << " ns" << std::endl;
+  std::cout << "bare:        " << tr << " ns" << std::endl;
+  std::cout << "agree:       " << (p.raw() == pr) << std::endl;
+  return 0;
+}
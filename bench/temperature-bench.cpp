@@ -0,0 +1,104 @@
+/// @file       bench/temperature-bench.cpp
+/// @brief      Throughput of conversion of readings of temperature.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+///
+/// Readings in degrees Celsius and in degrees Fahrenheit are converted into
+/// absolute temperatures in kelvins, first one at a time, by way of
+/// vnix::units::celsius() and fahrenheit(), and then by to_kelvins(); and
+/// then converted back, first one at a time and then by from_kelvins().  The
+/// arrays are small enough to stay in cache, and each conversion is repeated,
+/// so that the time is that of arithmetic rather than of memory.  Time per
+/// element is reported in nanoseconds.  The number of conversions in millions
+/// may be given as the first argument.
+
+#include <chrono>   // for steady_clock
+#include <cmath>    // for abs
+#include <cstdlib>  // for atoi
+#include <iostream> // for cout
+#include <limits>   // for numeric_limits
+#include <random>   // for mt19937
+#include <vector>   // for vector
+#include <vnix/units/temperature.hpp>
+
+using namespace vnix::units;
+using clk = std::chrono::steady_clock;
+
+
+/// Seconds elapsed since specified time.
+static double since(clk::time_point t0) {
+  return std::chrono::duration<double>(clk::now() - t0).count();
+}
+
+
+/// True only if corresponding elements agree up to rounding, which differs
+/// between the two paths if the compiler contract either into a fused
+/// multiply-add.  Because a reading may be the small difference of two
+/// terms, the tolerance is relative to the largest term, which is less than
+/// 1024 in this benchmark.
+template <typename T>
+static bool agree(std::vector<T> const &a, std::vector<T> const &b) {
+  T const tol = 4 * std::numeric_limits<T>::epsilon() * 1024;
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (std::abs(a[i] - b[i]) > tol) { return false; }
+  }
+  return true;
+}
+
+
+/// Compare conversion one at a time with conversion in bulk.
+/// @tparam S     Scale of readings.
+/// @tparam T     Type of number.
+/// @param  name  Name of scale and type.
+/// @param  n     Number of conversions.
+template <typename S, typename T>
+static void bench(char const *name, size_t n) {
+  using span = statdim_span<temperature_dim.encode(), T>;
+  using abs  = basic_abs_temperature<T>;
+  enum : size_t { M = 1024 }; // Number of elements in each array.
+  std::mt19937                      gen(1);
+  std::uniform_real_distribution<T> u(-40, 120);
+  std::vector<T>                    x(M), k1(M), k2(M), x1(M), x2(M);
+  for (size_t i = 0; i < M; ++i) { x[i] = u(gen); }
+  span const   s1(k1.data(), M), s2(k2.data(), M);
+  size_t const r  = (n + M - 1) / M; // Number of repetitions.
+  double const ns = 1.0E+09 / (r * M);
+
+  auto t0 = clk::now();
+  for (size_t j = 0; j < r; ++j) {
+    for (size_t i = 0; i < M; ++i) {
+      s1.set(i, abs::template on<S>(x[i]).from_zero());
+    }
+  }
+  double const to_one = since(t0);
+  t0                  = clk::now();
+  for (size_t j = 0; j < r; ++j) { to_kelvins<S>(x.data(), s2); }
+  double const to_bulk = since(t0);
+
+  t0 = clk::now();
+  for (size_t j = 0; j < r; ++j) {
+    for (size_t i = 0; i < M; ++i) {
+      x1[i] = abs(s1[i]).template in<S>();
+    }
+  }
+  double const from_one = since(t0);
+  t0                    = clk::now();
+  for (size_t j = 0; j < r; ++j) { from_kelvins<S>(s2, x2.data()); }
+  double const from_bulk = since(t0);
+
+  bool const ok = agree(k1, k2) && agree(x1, x2);
+  std::cout << name << ": to kelvins " << to_one * ns << " -> "
+            << to_bulk * ns << " ns, from kelvins " << from_one * ns << " -> "
+            << from_bulk * ns << " ns" << (ok ? "" : " (MISMATCH)")
+            << std::endl;
+}
+
+
+int main(int argc, char **argv) {
+  size_t const n = (argc > 1 ? std::atoi(argv[1]) : 100) * size_t(1000000);
+  bench<celsius_scale, float>("celsius    float ", n);
+  bench<fahrenheit_scale, float>("fahrenheit float ", n);
+  bench<celsius_scale, double>("celsius    double", n);
+  bench<fahrenheit_scale, double>("fahrenheit double", n);
+  return 0;
+}
@@ -0,0 +1,62 @@
+/// @file       bench/uncertain-bench.cpp
+/// @brief      Throughput of vnix::units::basic_uncertain_batch.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+///
+/// Speeds with uncertainty are computed from distances and times with
+/// uncertainty, first element by element as dimval<uncertain<double>>, and
+/// then by dividing, in place, a whole basic_uncertain_batch.  Time per
+/// element is reported in nanoseconds.  The number of elements in millions
+/// may be given as the first argument.
+
+#include <chrono>   // for steady_clock
+#include <cstdlib>  // for atoi
+#include <iostream> // for cout
+#include <random>   // for mt19937
+#include <vnix/units.hpp>
+#include <vnix/units/uncertain.hpp>
+
+using namespace vnix::units;
+using clk = std::chrono::steady_clock;
+
+
+/// Seconds elapsed since specified time.
+static double since(clk::time_point t0) {
+  return std::chrono::duration<double>(clk::now() - t0).count();
+}
+
+
+int main(int argc, char **argv) {
+  using namespace dbl;
+  size_t const n = (argc > 1 ? std::atoi(argv[1]) : 4) * size_t(1000000);
+  std::mt19937                           gen(1);
+  std::uniform_real_distribution<double> u(1, 2);
+  basic_uncertain_batch<double>          x(n, length_dim), t(n, time_dim);
+  for (size_t i = 0; i < n; ++i) {
+    x.set(i, with_sigma(u(gen) * m, 0.01 * m));
+    t.set(i, with_sigma(u(gen) * s, 0.01 * s));
+  }
+  double const ns = 1.0E+09 / n;
+
+  using uspeed = decltype(with_sigma(m, m) / with_sigma(s, s));
+  std::vector<uspeed> v;
+  v.reserve(n);
+  auto t0 = clk::now();
+  for (size_t i = 0; i < n; ++i) {
+    v.push_back(with_sigma(x.estimates()[i] * m, x.sigmas()[i] * m) /
+                with_sigma(t.estimates()[i] * s, t.sigmas()[i] * s));
+  }
+  std::cout << "each dimval:     " << since(t0) * ns << " ns" << std::endl;
+
+  auto b = x; // Numerator to be divided in place.
+  t0     = clk::now();
+  b /= t;
+  std::cout << "uncertain batch: " << since(t0) * ns << " ns" << std::endl;
+
+  double sum = 0;
+  for (size_t i = 0; i < n; i += 4096) {
+    sum += (sigma(v[i]) / (m / s)).to_number() - b.sigmas()[i];
+  }
+  std::cout << "(check: " << sum << ")" << std::endl;
+  return 0;
+}
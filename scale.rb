@@ -0,0 +1,63 @@
+# Definition of class Scale, for prefix of scaled unit.
+#
+# Copyright 2019, Thomas E. Vaughan; all rights reserved.
+#
+# Redistributable according to the terms of the BSD three-clause license; see
+# LICENSE.
+
+# Name and value of prefix, such as "kilo" and 1000 for "k".  This is required
+# by each erb-file that names scaled units.
+class Scale
+  attr_reader :name, :valu
+  def initialize(sym)
+    case sym
+    when "P"
+      @name = "peta"
+      @valu = 1.0E+15
+    when "T"
+      @name = "tera"
+      @valu = 1.0E+12
+    when "G"
+      @name = "giga"
+      @valu = 1.0E+09
+    when "M"
+      @name = "mega"
+      @valu = 1.0E+06
+    when "k"
+      @name = "kilo"
+      @valu = 1.0E+03
+    when "h"
+      @name = "hecto"
+      @valu = 1.0E+02
+    when "da"
+      @name = "deca"
+      @valu = 1.0E+01
+    when "d"
+      @name = "deci"
+      @valu = 1.0E-01
+    when "c"
+      @name = "centi"
+      @valu = 1.0E-02
+    when "m"
+      @name = "milli"
+      @valu = 1.0E-03
+    when "mu"
+      @name = "micro"
+      @valu = 1.0E-06
+    when "n"
+      @name = "nano"
+      @valu = 1.0E-09
+    when "p"
+      @name = "pico"
+      @valu = 1.0E-12
+    when "f"
+      @name = "femto"
+      @valu = 1.0E-15
+    else
+      raise "illegal symbol #{sym}"
+    end
+  end
+end
+
+
+# vim: set tw=79 sw=2 expandtab:
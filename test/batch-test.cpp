@@ -0,0 +1,101 @@
+/// @file       test/batch-test.cpp
+/// @brief      Test-cases for arithmetic on arrays of vnix::rat::rational.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+
+#include "../vnix/rat.hpp"
+#include "../vnix/rat/batch.hpp"
+#include "catch.hpp"
+#include <vector> // for vector
+
+using namespace vnix;
+
+
+/// Every rational in a small grid that fits in type R.
+/// @tparam R  Type of rational.
+template <typename R> std::vector<R> grid() {
+  std::vector<R> v;
+  for (int n = -9; n <= 9; ++n) {
+    for (int d = 1; d <= 7; ++d) { v.push_back(R(n, d)); }
+  }
+  return v;
+}
+
+
+/// Check each operation on arrays against the corresponding operator.
+/// @tparam R  Type of rational.
+template <typename R> void check_batch() {
+  std::vector<R> const g = grid<R>();
+  std::vector<R>       a, b;
+  for (R const &x : g) {
+    for (R const &y : g) {
+      a.push_back(x);
+      b.push_back(y);
+    }
+  }
+  size_t const   n = a.size();
+  std::vector<R> r(n);
+
+  rat::add(a.data(), b.data(), r.data(), n);
+  for (size_t i = 0; i < n; ++i) { REQUIRE(r[i] == R(a[i] + b[i])); }
+
+  rat::subtract(a.data(), b.data(), r.data(), n);
+  for (size_t i = 0; i < n; ++i) { REQUIRE(r[i] == R(a[i] - b[i])); }
+
+  rat::multiply(a.data(), b.data(), r.data(), n);
+  for (size_t i = 0; i < n; ++i) { REQUIRE(r[i] == R(a[i] * b[i])); }
+
+  // Divide only by nonzero divisors.
+  std::vector<R> c, e;
+  for (size_t i = 0; i < n; ++i) {
+    if (b[i] != R(0)) {
+      c.push_back(a[i]);
+      e.push_back(b[i]);
+    }
+  }
+  rat::divide(c.data(), e.data(), r.data(), c.size());
+  for (size_t i = 0; i < c.size(); ++i) { REQUIRE(r[i] == R(c[i] / e[i])); }
+}
+
+
+TEST_CASE("Operations on arrays match operators.", "[batch]") {
+  check_batch<rat16_t>();
+  check_batch<rat32_t>();
+  check_batch<rat64_t>();
+}
+
+
+TEST_CASE("Operations on arrays may overwrite operand.", "[batch]") {
+  rat16_t a[] = {{1, 2}, {-1, 3}, {5, 6}};
+  rat16_t b[] = {{1, 2}, {1, 6}, {-1, 6}};
+  rat::add(a, b, a, 3);
+  REQUIRE(a[0] == rat16_t(1));
+  REQUIRE(a[1] == rat16_t(-1, 6));
+  REQUIRE(a[2] == rat16_t(2, 3));
+  rat::multiply(a, b, b, 3);
+  REQUIRE(b[0] == rat16_t(1, 2));
+  REQUIRE(b[1] == rat16_t(-1, 36));
+  REQUIRE(b[2] == rat16_t(-1, 9));
+}
+
+
+TEST_CASE("Sum of array matches repeated addition.", "[batch]") {
+  std::vector<rat32_t> const g = grid<rat32_t>();
+  rat32_t                    s;
+  for (rat32_t const &x : g) { s += x; }
+  REQUIRE(rat::sum(g.data(), g.size()) == s);
+  REQUIRE(rat::sum(g.data(), 0) == rat32_t(0));
+
+  rat16_t const h[] = {{1, 2}, {1, 3}, {1, 6}};
+  REQUIRE(rat::sum(h, 3) == rat16_t(1));
+}
+
+
+TEST_CASE("Errors in operations on arrays are reported.", "[batch]") {
+  rat8_t const a[] = {{1, 2}, {15}};
+  rat8_t const b[] = {{0}, {15}};
+  rat8_t       r[2];
+  REQUIRE_THROWS(rat::divide(a, b, r, 1));
+  REQUIRE_THROWS(rat::add(a + 1, b + 1, r, 1));
+  REQUIRE_THROWS(rat::multiply(a + 1, b + 1, r, 1));
+}
@@ -19,3 +19,12 @@ TEST_CASE("Number of bits is properly clamped.", "[common-denom-params]") {
   REQUIRE(CDP::N2_BITS == 56);
 }
 
+
+
+TEST_CASE("Overflow of clamped numerator is detected.", "[common-denom]") {
+  using rat = rational<36, 36>;
+  rat const r1((rat::stype(1) << 35) - 1);
+  rat const r2(1, (rat::stype(1) << 36) - 1);
+  REQUIRE_THROWS(common_denom(r1, r2));
+  REQUIRE_NOTHROW(common_denom(r1, rat(1, 3)));
+}
@@ -0,0 +1,51 @@
+/// @file       test/converter-test.cpp
+/// @brief      Test-cases for vnix::units::basic_converter.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+
+#include "../vnix/units/converter.hpp"
+#include "catch.hpp"
+
+using namespace vnix::units;
+
+
+TEST_CASE("Converter fuses scale-factors once.", "[converter]") {
+  using namespace dbl;
+  basic_converter<double> const c1(ft, km);
+  REQUIRE(c1.factor() == Approx(3.048E-04));
+  REQUIRE(c1.apply(1000) == Approx(0.3048));
+  REQUIRE(c1.d() == length_dim);
+
+  basic_converter<float> const c2("erg", "mJ");
+  REQUIRE(c2.factor() == Approx(1.0E-04));
+
+  basic_converter<double> const c3("km/s", "m/ms");
+  REQUIRE(c3.factor() == Approx(1));
+
+  REQUIRE_THROWS(basic_converter<double>(ft, s));
+  REQUIRE_THROWS(basic_converter<double>("N", "J"));
+}
+
+
+TEST_CASE("Converter applies to arrays.", "[converter]") {
+  basic_converter<double> const c("mi", "ft");
+  double                        in[] = {1, 2, 3};
+  double                        out[3];
+  c.apply(in, 3, out);
+  REQUIRE(out[0] == Approx(5280));
+  REQUIRE(out[2] == Approx(15840));
+  c.apply(in, 3);
+  REQUIRE(in[1] == Approx(10560));
+}
+
+
+TEST_CASE("Converters are cached by pair of units.", "[converter]") {
+  auto const &c1 = converter<double>("ft", "km");
+  auto const &c2 = converter<double>("ft", "km");
+  auto const &c3 = converter<double>("km", "ft");
+  REQUIRE(&c1 == &c2);
+  REQUIRE(&c1 != &c3);
+  REQUIRE(c1.factor() * c3.factor() == Approx(1));
+  REQUIRE(converter_cache<double>::instance().size() >= 2);
+  REQUIRE_THROWS(converter<double>("ft", "s"));
+}
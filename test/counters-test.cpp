@@ -0,0 +1,113 @@
+/// @file       test/counters-test.cpp
+/// @brief      Test-cases for vnix::units::counters.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+
+#include "../vnix/units/counters.hpp"
+#include "../vnix/units.hpp"
+#include "../vnix/units/converter.hpp"
+#include "catch.hpp"
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace vnix::units;
+
+
+TEST_CASE("Counters are kept per thread and summed.", "[counters]") {
+  counters::reset();
+  REQUIRE(counters::thread()[counter::check] == 0);
+  counters::bump(counter::check);
+  counters::bump(counter::convert, 5);
+  REQUIRE(counters::thread()[counter::check] == 1);
+  REQUIRE(counters::thread()[counter::convert] == 5);
+
+  std::thread t([] {
+    REQUIRE(counters::thread()[counter::check] == 0);
+    counters::bump(counter::check, 2);
+  });
+  t.join();
+
+  // Thread's counts survive its exit.
+  REQUIRE(counters::thread()[counter::check] == 1);
+  REQUIRE(counters::total()[counter::check] == 3);
+  REQUIRE(counters::total()[counter::convert] == 5);
+
+  counters::reset();
+  REQUIRE(counters::total()[counter::check] == 0);
+  REQUIRE(counters::thread()[counter::convert] == 0);
+}
+
+
+TEST_CASE("Counters are dumped by name.", "[counters]") {
+  REQUIRE(std::string(counters::name(counter::mismatch)) == "mismatch");
+  REQUIRE(std::string(counters::name(counter::convert)) == "convert");
+  counters::reset();
+  counters::bump(counter::throws, 7);
+  std::ostringstream oss;
+  counters::dump(oss);
+  std::string const s = oss.str();
+  REQUIRE(s.find("check 0\n") == 0);
+  REQUIRE(s.find("throws 7\n") != std::string::npos);
+  REQUIRE(s.find("convert 0\n") != std::string::npos);
+  counters::reset();
+}
+
+
+#ifdef VNIX_UNITS_COUNTERS
+
+TEST_CASE("Counters record run-time dimension-work.", "[counters]") {
+  using namespace dbl;
+  dyndim const a = 3.0 * m;
+  dyndim const b = 2.0 * s;
+  dyndim const c = 4.0 * m;
+
+  counters::reset();
+  dyndim const d = a + c;
+  REQUIRE(counters::thread()[counter::check] == 1);
+  REQUIRE(counters::thread()[counter::mismatch] == 0);
+  REQUIRE_THROWS(a + b);
+  REQUIRE(counters::thread()[counter::check] == 2);
+  REQUIRE(counters::thread()[counter::mismatch] == 1);
+  REQUIRE(counters::thread()[counter::throws] == 1);
+
+  // Integer exponents are added in one operation on the packed word.
+  counters::reset();
+  dyndim const e = a * b;
+  REQUIRE(counters::thread()[counter::combine] == 0);
+  dyndim const f = sqrt(d);
+  REQUIRE(counters::thread()[counter::sqrt] == 1);
+  REQUIRE(counters::thread()[counter::transform] == 1);
+  dyndim const g = pow<2>(e);
+  REQUIRE(counters::thread()[counter::power] == 1);
+
+  // Fractional exponents are combined one by one.
+  dyndim const h = f * f;
+  REQUIRE(counters::thread()[counter::combine] == 1);
+  REQUIRE(h.d() == d.d());
+
+  // Dimension of statdim is known at compile-time, and so nothing is done.
+  counters::reset();
+  length const l1 = 3.0 * m;
+  length const l2 = l1 + l1;
+  area const   ar = l1 * l2;
+  REQUIRE(counters::thread()[counter::check] == 0);
+  REQUIRE(counters::thread()[counter::combine] == 0);
+
+  // Mixing statdim with dyndim costs a check.
+  length const l3 = l1 + a;
+  REQUIRE(counters::thread()[counter::check] == 1);
+
+  counters::reset();
+  basic_converter<double> const cv(ft, km);
+  double x[4] = {1, 2, 3, 4};
+  cv.apply(x, 4);
+  REQUIRE(counters::thread()[counter::convert] == 4);
+  counters::reset();
+  (void)f;
+  (void)g;
+  (void)ar;
+  (void)l3;
+}
+
+#endif // def VNIX_UNITS_COUNTERS
@@ -0,0 +1,71 @@
+/// @file       test/csv-test.cpp
+/// @brief      Test-cases for vnix::units::basic_csv_reader and write_csv.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+
+#include "../vnix/units/csv.hpp"
+#include "catch.hpp"
+#include <sstream> // for istringstream, ostringstream
+
+using namespace vnix::units;
+
+
+TEST_CASE("CSV header is parsed once.", "[csv]") {
+  auto const f = parse_csv_header("t[s], x[km],F[mN],n\r");
+  REQUIRE(f.size() == 4);
+  REQUIRE(f[1].name == "x");
+  REQUIRE(f[1].unit == "km");
+  REQUIRE(f[1].u.d == length_dim);
+  REQUIRE(f[2].u.d == dbl::force::d());
+  REQUIRE(f[3].name == "n");
+  REQUIRE(f[3].u.d == nul_dim);
+  REQUIRE_THROWS(parse_csv_header("t[s],x[parsec]"));
+  REQUIRE_THROWS(parse_csv_header("t[s"));
+}
+
+
+TEST_CASE("CSV reader converts columns to base-units.", "[csv]") {
+  using namespace dbl;
+  std::ostringstream oss;
+  oss << "t[s],x[km],F[mN]\n";
+  int const n = 5000;
+  for (int i = 0; i < n; ++i) { oss << i << "," << 0.5 * i << ",2\n"; }
+  oss << n << ",1,3"; // Last line without newline.
+  for (unsigned threads = 1; threads <= 4; threads *= 2) {
+    std::istringstream iss(oss.str());
+    // Small chunks exercise the carrying of partial lines across chunks.
+    auto const t = basic_csv_reader<double>(997, threads).read(iss);
+    REQUIRE(t.rows() == n + 1);
+    auto const x = t.column<length>("x");
+    REQUIRE(x[10] == 5.0_km);
+    REQUIRE(t.column<dbl::time>("t")[n] == n * s);
+    REQUIRE((t.column<force>("F")[n] / mN).to_number() == Approx(3));
+  }
+}
+
+
+TEST_CASE("CSV reader rejects malformed rows.", "[csv]") {
+  std::istringstream few("a[m],b[s]\n1,2\n3\n");
+  REQUIRE_THROWS(basic_csv_reader<float>().read(few));
+  std::istringstream many("a[m],b[s]\n1,2,3\n");
+  REQUIRE_THROWS(basic_csv_reader<float>().read(many));
+  std::istringstream empty("a[m],b[s]\n1,,\n");
+  REQUIRE_THROWS(basic_csv_reader<float>().read(empty));
+}
+
+
+TEST_CASE("CSV writer converts from base-units.", "[csv]") {
+  using namespace dbl;
+  basic_table<double> t({column_spec::of<length>("x"),
+                         column_spec::of<speed>("v")});
+  t.append({1.5_km, 3 * m / s});
+  std::ostringstream oss;
+  write_csv(oss, t, {"km", "km/s"});
+  REQUIRE(oss.str().substr(0, 18) == "x[km],v[km/s]\n1.5,");
+  REQUIRE_THROWS(write_csv(oss, t, {"km", "km"}));
+
+  std::istringstream iss(oss.str());
+  auto const         u = basic_csv_reader<double>().read(iss);
+  REQUIRE(u.at(0, 0) == 1.5_km);
+  REQUIRE((u.at(0, 1) / (m / s)).to_number() == Approx(3.0));
+}
@@ -0,0 +1,64 @@
+/// @file       test/dim-partition-test.cpp
+/// @brief      Test-cases for vnix::units::basic_dim_partition.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+
+#include "../vnix/units/dim-partition.hpp"
+#include "../vnix/units.hpp"
+#include "catch.hpp"
+#include <unordered_set>
+
+using namespace vnix::units;
+
+
+TEST_CASE("Partition groups quantities by dimension.", "[dim-partition]") {
+  using namespace dbl;
+  std::vector<dyndim> const v = {1 * m, 2 * s, 3 * N, 4 * km,
+                                 5 * ms, 6 * mN, 7 * m, 8.0};
+  basic_dim_partition<double> const p(v);
+  REQUIRE(p.size() == v.size());
+  REQUIRE(p.groups() == 4);
+  REQUIRE(p.d(0) == length_dim);
+  REQUIRE(p.d(1) == time_dim);
+  REQUIRE(p.d(2) == force::d());
+  REQUIRE(p.d(3) == nul_dim);
+  REQUIRE(p.find(mass_dim) == p.groups());
+
+  auto const len = p.group(0);
+  REQUIRE(len.size() == 3);
+  REQUIRE(len[0] == 1 * m);
+  REQUIRE(len[1] == 4 * km);
+  REQUIRE(len[2] == 7 * m);
+  REQUIRE(p.index(0)[0] == 0);
+  REQUIRE(p.index(0)[1] == 3);
+  REQUIRE(p.index(0)[2] == 6);
+
+  auto const f = p.group_of<force>();
+  REQUIRE(f.size() == 2);
+  REQUIRE(f[1] == 6 * mN);
+  REQUIRE(p.group_of<energy>().empty());
+  REQUIRE(p.group(3)[0] == dyndim(8.0));
+}
+
+
+TEST_CASE("Partition handles many distinct dimensions.", "[dim-partition]") {
+  using namespace dbl;
+  std::vector<dyndim> v;
+  for (int i = 0; i < 1000; ++i) {
+    dim const d(i % 7 - 3, i % 5 - 2, i % 3 - 1, 0, 0);
+    v.push_back(dimval<double, dyndim_base>(i, d));
+  }
+  basic_dim_partition<double> const p(v);
+  std::unordered_set<dim>           seen;
+  size_t                            total = 0;
+  for (size_t g = 0; g < p.groups(); ++g) {
+    REQUIRE(seen.insert(p.d(g)).second);
+    auto const s = p.group(g);
+    for (size_t i = 0; i < s.size(); ++i) {
+      REQUIRE(v[p.index(g)[i]] == s[i]);
+    }
+    total += s.size();
+  }
+  REQUIRE(p.groups() == 105);
+  REQUIRE(total == v.size());
+}
@@ -65,3 +65,126 @@ TEST_CASE("Multiplication and division work as expected.", "[dim]") {
   REQUIRE(x * b == z1);
   REQUIRE(x / b == z2);
 }
+
+
+TEST_CASE("Packed addition agrees with addition of each exponent.", "[dim]") {
+  for (int i = -4; i < 4; ++i) {
+    for (int j = -3; j < 4; ++j) {
+      dim const x(i, j, -i, 0, 1), y(j, i, 3, -2, -1);
+      REQUIRE(x + y == x.combine(y, dim::add));
+      REQUIRE(x - y == x.combine(y, dim::sbtrct));
+      dim const z(dim::rat(1, 2), 0, j, 0, 0);
+      REQUIRE(z + y == z.combine(y, dim::add));
+      REQUIRE(z - y == z.combine(y, dim::sbtrct));
+    }
+  }
+  REQUIRE_THROWS(dim(7, 0, 0, 0, 0) + dim(1, 0, 0, 0, 0));
+  REQUIRE_THROWS(dim(-8, 0, 0, 0, 0) - dim(1, 0, 0, 0, 0));
+  REQUIRE(dim(7, 0, 0, 0, 0) + dim(-8, 0, 0, 0, 0) == dim(-1, 0, 0, 0, 0));
+}
+
+
+TEST_CASE("Packed power and root agree with each exponent.", "[dim]") {
+  for (int i = -2; i < 3; ++i) {
+    for (int k = -3; k < 4; ++k) {
+      dim const      x(i, -i, 1, 0, -1), h(dim::rat(1, 2), i, 0, 0, 0);
+      dim::rat const f(k);
+      REQUIRE(x * f == x.transform(dim::mult(f)));
+      REQUIRE(h * f == h.transform(dim::mult(f)));
+      dim const y = x + x;
+      REQUIRE(y / 2 == y.transform(dim::divd(2)));
+      REQUIRE(x / 2 == x.transform(dim::divd(2)));
+    }
+  }
+  // Overflow of packed power falls back, and so only overflow of result
+  // throws.
+  REQUIRE(dim(4, 0, 0, 0, 0) * dim::rat(-2) == dim(-8, 0, 0, 0, 0));
+  REQUIRE_THROWS(dim(-4, 0, 0, 0, 0) * dim::rat(-2));
+  REQUIRE_THROWS(dim(4, 0, 0, 0, 0) * dim::rat(2));
+  REQUIRE(dim(-8, 0, 0, 0, 0) / 2 == dim(-4, 0, 0, 0, 0));
+}
+
+
+/// Basis of nine dimensions, with eight bits per exponent.
+struct wide_dim_base_off {
+  /// C-style enumeration of offsets.
+  enum off : uint_fast8_t {
+    length,
+    mass,
+    time,
+    current,
+    temperature,
+    amount,
+    luminosity,
+    angle,
+    information
+  };
+
+  off offset; ///< Allow declaration of meaningful instance.
+
+  /// Automatically convert instance to type of enum.
+  constexpr operator off() const { return offset; }
+
+  /// Allow construction of constant-expression instance.
+  constexpr wide_dim_base_off(off os) : offset(os) {}
+
+  constexpr static uint_fast8_t num_offs = 9; ///< Number of offsets.
+  constexpr static unsigned     nmr_bits = 6; ///< Bits for numerator.
+  constexpr static unsigned     dnm_bits = 2; ///< Bits for denominator.
+
+  /// Array of enumerated offsets for iterating.
+  constexpr static off const array[num_offs] = {
+      length, mass,       time,  current,    temperature,
+      amount, luminosity, angle, information};
+
+  /// Array of basis-dimension symbols, one for each offset.
+  constexpr static char const *const sym[num_offs] = {
+      "m", "kg", "s", "A", "K", "mol", "cd", "rad", "bit"};
+};
+
+constexpr wide_dim_base_off::off const wide_dim_base_off::array[];
+constexpr char const *const            wide_dim_base_off::sym[];
+
+
+#ifdef __SIZEOF_INT128__
+TEST_CASE("dim with nine bases is encoded in 128 bits.", "[dim]") {
+  using wdim = basic_dim<wide_dim_base_off>;
+  using off  = wide_dim_base_off;
+  REQUIRE(sizeof(wdim::word) == 16);
+  REQUIRE(wdim::rat::BITS == 8);
+
+  wdim const bit(0, 0, 0, 0, 0, 0, 0, 0, 1);
+  wdim const rate = bit - wdim(0, 0, 1, 0, 0, 0, 0, 0, 0);
+  REQUIRE(rate[off::information] == wdim::rat(1));
+  REQUIRE(rate[off::time] == wdim::rat(-1));
+  REQUIRE(wdim(rate.encode()) == rate);
+
+  wdim const big = bit * wdim::rat(15);
+  REQUIRE(big[off::information] == wdim::rat(15));
+  REQUIRE(big + big - big == big);
+  REQUIRE_THROWS(big + big + big);
+
+  wdim const half = bit / wdim::rat(2);
+  REQUIRE(half + half == bit);
+  REQUIRE(bit - half == half);
+
+  std::ostringstream oss;
+  oss << rate;
+  REQUIRE(oss.str() == " s^-1 bit");
+}
+#endif
+
+
+TEST_CASE("dim is hashed and totally ordered by encoding.", "[dim]") {
+  dim const            length_dim(1, 0, 0, 0, 0), mass_dim(0, 1, 0, 0, 0);
+  dim const            time_dim(0, 0, 1, 0, 0);
+  std::hash<dim> const h;
+  REQUIRE(h(length_dim) == h(dim(length_dim.encode())));
+  REQUIRE(h(length_dim) != h(mass_dim));
+  REQUIRE(length_dim < mass_dim);
+  REQUIRE(mass_dim > length_dim);
+  REQUIRE(length_dim <= length_dim);
+  REQUIRE(length_dim >= length_dim);
+  REQUIRE(!(length_dim < length_dim));
+  REQUIRE((nul_dim < time_dim) != (time_dim < nul_dim));
+}
@@ -0,0 +1,128 @@
+/// @file       test/dual-test.cpp
+/// @brief      Test-cases for vnix::units::dual.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+
+#include "../vnix/units/dual.hpp"
+#include "../vnix/units.hpp"
+#include "catch.hpp"
+#include <cmath>
+#include <sstream>
+
+using namespace vnix::units;
+
+
+TEST_CASE("Dual number obeys chain rule.", "[dual]") {
+  using D = dual<double, 2>;
+  D const x(3, 0), y(4, 1);
+  REQUIRE_THROWS(D(1, 2));
+
+  D const f = x * x * y; // df/dx = 2xy = 24, df/dy = x^2 = 9.
+  REQUIRE(f.v == 36);
+  REQUIRE(f.g[0] == 24);
+  REQUIRE(f.g[1] == 9);
+
+  D const q = x / y; // dq/dx = 1/y, dq/dy = -x/y^2.
+  REQUIRE(q.v == Approx(0.75));
+  REQUIRE(q.g[0] == Approx(0.25));
+  REQUIRE(q.g[1] == Approx(-3.0 / 16.0));
+
+  D const r = sqrt(x * x + y * y); // dr/dx = x/r, dr/dy = y/r.
+  REQUIRE(r.v == Approx(5));
+  REQUIRE(r.g[0] == Approx(0.6));
+  REQUIRE(r.g[1] == Approx(0.8));
+
+  D const p = pow(x, 3.0);
+  REQUIRE(p.v == Approx(27));
+  REQUIRE(p.g[0] == Approx(27));
+  REQUIRE(p.g[1] == 0);
+
+  D const c = 2.0 * x - y + D(1);
+  REQUIRE(c.v == 3);
+  REQUIRE(c.g[0] == 2);
+  REQUIRE(c.g[1] == -1);
+  REQUIRE((-c).g[1] == 1);
+  REQUIRE(x < y);
+
+  std::ostringstream oss;
+  oss << f;
+  REQUIRE(oss.str() == "(36; 24, 9)");
+}
+
+
+TEST_CASE("Derivative has quotient dimension.", "[dual]") {
+  using namespace dbl;
+  // Kinetic energy as function of mass and of speed.
+  auto const ms = independent<2>(2.0 * kg, 0);
+  auto const v  = independent<2>(3.0 * m / s, 1);
+  auto const e  = 0.5 * ms * v * v;
+  energy const ev = value(e);
+  REQUIRE(ev == 9.0 * J);
+
+  // dE/dv = m v, in kg m/s; known at compile-time.
+  auto const dedv = derivative(e, v, 1);
+  momentum const pv = dedv;
+  REQUIRE(pv == 6.0 * kg * m / s);
+  auto const dedm = derivative(e, ms, 0);
+  REQUIRE(dedm == 4.5 * m * m / (s * s));
+
+  // Through a square-root and with dimension known only at run-time.
+  dyndim const       dl = 4.0 * m;
+  auto const         l  = independent<1>(dl, 0);
+  auto const         a  = l * l;
+  dyndim const       r  = derivative(a.square_root(), l, 0);
+  REQUIRE(r.d() == nul_dim);
+  REQUIRE(r.to_number() == Approx(1));
+  auto const c = pow<3>(independent<1>(2.0 * m, 0));
+  REQUIRE(derivative(c, m, 0) == 12.0 * m * m);
+  REQUIRE_THROWS(derivative(c, m, 1));
+}
+
+
+TEST_CASE("Dual batch differentiates across samples.", "[dual]") {
+  using namespace dbl;
+  size_t const             n = 1000;
+  basic_dual_batch<double, 2> x(n, length_dim), t(n, time_dim);
+  for (size_t i = 0; i < n; ++i) {
+    x.values()[i] = double(i + 1);
+    t.values()[i] = 2.0;
+  }
+  x.seed(0);
+  t.seed(1);
+  REQUIRE_THROWS(x.seed(2));
+  REQUIRE_THROWS(x.set(0, independent<2>(2.0 * s, 1)));
+
+  // v = x / t; dv/dx = 1/t, dv/dt = -x/t^2.
+  auto const v = x / t;
+  REQUIRE(v.d() == speed::d());
+  for (size_t i = 0; i < n; i += 97) {
+    auto const e = x[i] / t[i];
+    REQUIRE(v.values()[i] == Approx(value(e).raw_number()));
+    REQUIRE(v.derivatives(0)[i] == Approx(0.5));
+    REQUIRE(v.derivatives(1)[i] == Approx(-double(i + 1) / 4));
+    REQUIRE(v.derivative(i, 1, time_dim) == derivative(e, 1.0 * s, 1));
+  }
+  dyndim const dvdx = v.derivative(0, 0, length_dim);
+  REQUIRE(dvdx.d() == nul_dim - time_dim);
+
+  auto const a = x * x + x * x - x * x;
+  REQUIRE(a.d() == length_dim + length_dim);
+  auto const r = sqrt(a);
+  REQUIRE(r.d() == length_dim);
+  REQUIRE(r.derivatives(0)[9] == Approx(1));
+  auto const c = pow(x, dim::rat(3));
+  REQUIRE(c.derivatives(0)[9] == Approx(300));
+  REQUIRE(c.derivatives(1)[9] == 0);
+
+  auto y = x;
+  y /= t;
+  y *= t;
+  REQUIRE(y.d() == length_dim);
+  REQUIRE(y.derivatives(0)[7] == Approx(1));
+  REQUIRE(y.derivatives(1)[7] == Approx(0).margin(1.0E-12));
+  y.set(3, independent<2>(5.0 * m, 1));
+  REQUIRE(y.derivatives(1)[3] == 1);
+
+  REQUIRE_THROWS(x + t);
+  REQUIRE_THROWS(x / basic_dual_batch<double, 2>(3, time_dim));
+}
@@ -0,0 +1,32 @@
+/// @file       test/error-test.cpp
+/// @brief      Test-cases for vnix::error.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+
+#include "../vnix/units.hpp"
+#include "catch.hpp"
+#include <cstring>
+
+using namespace vnix;
+
+
+TEST_CASE("With exceptions, error throws message.", "[error]") {
+  REQUIRE(VNIX_EXCEPTIONS);
+  try {
+    error("message");
+    FAIL("expected exception");
+  } catch (char const *e) { REQUIRE(std::strcmp(e, "message") == 0); }
+
+  // The handler is used only without exceptions.
+  error_handler const h = set_error_handler(record_error);
+  REQUIRE(h == abort_on_error);
+  using rat42  = rat::rational<4, 2>;
+  auto const z = rat42(0);
+  REQUIRE_THROWS_WITH(z.reciprocal(), "attempt to take reciprocal of zero");
+  REQUIRE(last_error() == nullptr);
+  REQUIRE(set_error_handler(h) == record_error);
+
+  using namespace units::dbl;
+  REQUIRE(!noexcept(dyndim(1.0) + dyndim(1.0)));
+  REQUIRE_THROWS(dyndim(1.0 * m) + dyndim(1.0 * s));
+}
@@ -130,3 +130,49 @@ TEST_CASE("Otherwise, GCD works.", "[gcd]") {
   REQUIRE(gcd(6, 9) == 3);
   REQUIRE(gcd(9, 6) == 3);
 }
+
+
+TEST_CASE("GCD uses absolute values.", "[gcd]") {
+  REQUIRE(gcd(-4, 6) == 2);
+  REQUIRE(gcd(4, -6) == 2);
+  REQUIRE(gcd(-4, -6) == 2);
+  REQUIRE(gcd(-7, 0) == 7);
+  REQUIRE(gcd(0, -7) == 7);
+}
+
+
+TEST_CASE("GCD works for wide numbers.", "[gcd]") {
+  int64_t const p = 2147483647; // Prime.
+  REQUIRE(gcd(p * 3 * 64, p * 5 * 16) == p * 16);
+  REQUIRE(gcd(uint64_t(1) << 63, uint64_t(3) << 40) == uint64_t(1) << 40);
+  REQUIRE(gcd(INT64_MIN, int64_t(1) << 62) == int64_t(1) << 62);
+#ifdef __SIZEOF_INT128__
+  __extension__ typedef unsigned __int128 u128;
+  REQUIRE(gcd(u128(3) << 100, u128(6) << 70) == u128(3) << 71);
+#endif
+}
+
+
+TEST_CASE("GCD is evaluated at compile-time.", "[gcd]") {
+  static_assert(gcd(48, -36) == 12, "gcd(48, -36)");
+  static_assert(gcd(0, 0) == 0, "gcd(0, 0)");
+  static_assert(gcd(1024u, 96u) == 32u, "gcd(1024, 96)");
+}
+
+
+TEST_CASE("GCD agrees with Euclid's algorithm on every 8-bit pair.",
+          "[gcd]") {
+  bool ok = true;
+  for (int a = 0; a < 256; ++a) {
+    for (int b = 0; b < 256; ++b) {
+      int x = a, y = b;
+      while (y != 0) {
+        int const r = x % y;
+        x           = y;
+        y           = r;
+      }
+      ok = ok && (gcd(uint8_t(a), uint8_t(b)) == x);
+    }
+  }
+  REQUIRE(ok);
+}
@@ -0,0 +1,81 @@
+/// @file       test/histogram-test.cpp
+/// @brief      Test-cases for vnix::units::basic_histogram.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+
+#include "../vnix/units/histogram.hpp"
+#include "../vnix/units.hpp"
+#include "catch.hpp"
+#include <cmath>
+
+using namespace vnix::units;
+
+
+TEST_CASE("Uniform histogram counts quantities.", "[histogram]") {
+  using namespace dbl;
+  histogram<speed> h(0 * m / s, 10 * m / s, 5);
+  REQUIRE(h.bins() == 5);
+  REQUIRE(h.uniform());
+  REQUIRE(h.edge(1) == 2 * m / s);
+
+  std::vector<double> x = {-1, 0, 1.9, 2, 3, 9.99, 10, 11, NAN};
+  h.fill(dyndim_span<double>(x.data(), x.size(), speed::d()));
+  REQUIRE(h.underflow() == 1);
+  REQUIRE(h.count(0) == 2);
+  REQUIRE(h.count(1) == 2);
+  REQUIRE(h.count(4) == 1);
+  REQUIRE(h.overflow() == 3);
+  REQUIRE(h.total() == x.size());
+
+  h.add(5 * m / s);
+  REQUIRE(h.count(2) == 1);
+
+  REQUIRE_THROWS(h.fill(dyndim_span<double>(x.data(), x.size(), time_dim)));
+  REQUIRE_THROWS(histogram<speed>(1 * m / s, 1 * m / s, 4));
+  REQUIRE_THROWS(histogram<speed>(dyndim(1 * s), 2 * m / s, 4));
+}
+
+
+TEST_CASE("Histogram with arbitrary edges counts quantities.", "[histogram]") {
+  using namespace dbl;
+  histogram<length> const proto({1 * m, 1 * km, 10 * km, 100 * km});
+  histogram<length>       h = proto;
+  REQUIRE(h.bins() == 3);
+  REQUIRE(!h.uniform());
+
+  std::vector<double> x = {0.5, 1, 999, 1000, 5e4, 1e5, 1e6, NAN};
+  h.fill(statdim_span<length::d().encode(), double>(x.data(), x.size()));
+  REQUIRE(h.underflow() == 1);
+  REQUIRE(h.count(0) == 2);
+  REQUIRE(h.count(1) == 1);
+  REQUIRE(h.count(2) == 1);
+  REQUIRE(h.overflow() == 3);
+
+  REQUIRE_THROWS(histogram<length>({1 * m, 1 * m}));
+  REQUIRE_THROWS(histogram<length>({2 * m, 1 * m}));
+}
+
+
+TEST_CASE("Threaded fill agrees with serial fill.", "[histogram]") {
+  using namespace dbl;
+  std::vector<double> x(100000);
+  for (size_t i = 0; i < x.size(); ++i) { x[i] = std::sin(i * 0.001) * 120; }
+  statdim_span<temperature_dim.encode(), double const> s(x.data(), x.size());
+
+  histogram<temperature> h1(-100 * K, 100 * K, 17), h3 = h1;
+  h1.fill(s);
+  h3.fill(s, 3);
+  for (size_t b = 0; b < h1.bins(); ++b) {
+    REQUIRE(h1.count(b) == h3.count(b));
+  }
+  REQUIRE(h1.underflow() == h3.underflow());
+  REQUIRE(h1.overflow() == h3.overflow());
+
+  histogram<temperature> e({-100 * K, -10 * K, 0 * K, 100 * K});
+  e.fill(s, 4);
+  REQUIRE(e.total() == x.size());
+
+  h1.merge(h3);
+  REQUIRE(h1.total() == 2 * x.size());
+  REQUIRE_THROWS(h1.merge(histogram<temperature>(-100 * K, 100 * K, 16)));
+}
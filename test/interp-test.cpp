@@ -0,0 +1,127 @@
+/// @file       test/interp-test.cpp
+/// @brief      Test-cases for vnix::units::basic_interp and basic_interp2.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+
+#include "../vnix/units/interp.hpp"
+#include "../vnix/units.hpp"
+#include "catch.hpp"
+#include <cmath>
+
+using namespace vnix::units;
+
+static auto const Pa = dbl::N / dbl::m / dbl::m; ///< Pascal.
+
+
+TEST_CASE("Linear interpolation checks dimensions.", "[interp]") {
+  using namespace dbl;
+  interp<length, pressure> const p({0 * m, 1 * km, 3 * km},
+                                   {100 * Pa, 90 * Pa, 70 * Pa});
+  REQUIRE(p.size() == 3);
+  REQUIRE(!p.uniform());
+  REQUIRE(p(0 * m) == 100 * Pa);
+  REQUIRE(p(500 * m) == 95 * Pa);
+  REQUIRE(p(2 * km) == 80 * Pa);
+  REQUIRE(p(3 * km) == 70 * Pa);
+  REQUIRE(p(-1 * km) == 100 * Pa); // Clamped at each end.
+  REQUIRE(p(5 * km) == 70 * Pa);
+
+  REQUIRE_THROWS(p(dyndim(1 * s)));
+  REQUIRE_THROWS(interp<length, pressure>({0 * m, 1 * s}, {1 * Pa, 2 * Pa}));
+  REQUIRE_THROWS(interp<length, pressure>({0 * m, 1 * m}, {1 * Pa, 2 * m}));
+  REQUIRE_THROWS(interp<length, pressure>({0 * m, 1 * m}, {1 * Pa}));
+  REQUIRE_THROWS(interp<length, pressure>({0 * m}, {1 * Pa}));
+  REQUIRE_THROWS(interp<length, pressure>({1 * m, 0 * m}, {1 * Pa, 2 * Pa}));
+}
+
+
+TEST_CASE("Monotone cubic interpolation preserves monotonicity.", "[interp]") {
+  using namespace dbl;
+  std::vector<dbl::time> x;
+  std::vector<length>        y;
+  double const               yv[] = {0, 0, 0, 1, 5, 5.5, 5.5, 10};
+  for (int i = 0; i < 8; ++i) {
+    x.push_back(i * s);
+    y.push_back(yv[i] * m);
+  }
+  interp<dbl::time, length> const f(x, y, interp_method::monotone_cubic);
+  REQUIRE(f.uniform());
+  for (int i = 0; i < 8; ++i) { REQUIRE(f(x[i]) == y[i]); }
+  length prev = f(0 * s);
+  for (int i = 1; i <= 700; ++i) {
+    length const cur = f(i * 0.01 * s);
+    REQUIRE(cur >= prev);
+    prev = cur;
+  }
+  REQUIRE(f(1.5 * s) == 0 * m); // Flat where data are flat.
+
+  // Cubic reproduces a straight line exactly.
+  interp<dbl::time, length> const g({0 * s, 1 * s, 3 * s, 4 * s},
+                                        {0 * m, 2 * m, 6 * m, 8 * m},
+                                        interp_method::monotone_cubic);
+  REQUIRE(g(2.5 * s).raw_number() == Approx(5));
+}
+
+
+TEST_CASE("Batch interpolation agrees with scalar interpolation.", "[interp]") {
+  using namespace dbl;
+  for (bool const uni : {true, false}) {
+    std::vector<length>   x;
+    std::vector<pressure> y;
+    for (int i = 0; i < 20; ++i) {
+      x.push_back((uni ? i : i * i) * km);
+      y.push_back(std::exp(-0.1 * i) * Pa);
+    }
+    for (auto method : {interp_method::linear, interp_method::monotone_cubic}) {
+      interp<length, pressure> const p(x, y, method);
+      REQUIRE(p.uniform() == uni);
+      std::vector<double> xi(1000), yo(1000);
+      for (size_t i = 0; i < xi.size(); ++i) {
+        xi[i] = (uni ? 20.0 : 400.0) * (i - 100.0) / 800.0 * 1000;
+      }
+      xi[7] = NAN;
+      p(dyndim_span<double const>(xi.data(), xi.size(), length_dim),
+        dyndim_span<double>(yo.data(), yo.size(), pressure::d()));
+      for (size_t i = 0; i < xi.size(); ++i) {
+        if (i == 7) {
+          REQUIRE(std::isnan(yo[i]));
+          continue;
+        }
+        REQUIRE(yo[i] == p(dyndim(xi[i] * m)).raw_number());
+      }
+      REQUIRE_THROWS(
+          p(dyndim_span<double const>(xi.data(), xi.size(), time_dim),
+            dyndim_span<double>(yo.data(), yo.size(), pressure::d())));
+      REQUIRE_THROWS(
+          p(dyndim_span<double const>(xi.data(), 5, length_dim),
+            dyndim_span<double>(yo.data(), yo.size(), pressure::d())));
+    }
+  }
+}
+
+
+TEST_CASE("Bilinear interpolation works on grid.", "[interp]") {
+  using namespace dbl;
+  interp2<temperature, pressure, length> const f(
+      {0 * K, 10 * K}, {0 * Pa, 1 * Pa, 3 * Pa},
+      {0 * m, 1 * m, 3 * m, 10 * m, 11 * m, 13 * m});
+  REQUIRE(f(0 * K, 0 * Pa) == 0 * m);
+  REQUIRE(f(10 * K, 3 * Pa) == 13 * m);
+  REQUIRE(f(5 * K, 2 * Pa) == 7 * m);
+  REQUIRE(f(20 * K, -1 * Pa) == 10 * m);
+
+  double const xi[] = {0, 5, 10};
+  double const yi[] = {1000, 2000, 3000}; // Pascal is 1000 in basis.
+  double       zo[3];
+  f(statdim_span<temperature::d().encode(), double const>(xi, 3),
+    statdim_span<pressure::d().encode(), double const>(yi, 3),
+    statdim_span<length::d().encode(), double>(zo, 3));
+  REQUIRE(zo[0] == 1);
+  REQUIRE(zo[1] == 7);
+  REQUIRE(zo[2] == 13);
+
+  REQUIRE_THROWS(interp2<temperature, pressure, length>(
+      {0 * K, 1 * K}, {0 * Pa, 1 * Pa}, {0 * m, 1 * m, 2 * m}));
+  REQUIRE_THROWS(interp2<temperature, pressure, length>(
+      {0 * K, 1 * K}, {0 * Pa, 1 * Pa}, {0 * m, 1 * m, 2 * m, 3 * s}));
+}
@@ -0,0 +1,153 @@
+/// @file       test/interval-test.cpp
+/// @brief      Test-cases for vnix::units::interval.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+
+#include "../vnix/units/interval.hpp"
+#include "../vnix/units.hpp"
+#include "catch.hpp"
+#include <cmath>
+#include <sstream>
+
+using namespace vnix::units;
+
+
+TEST_CASE("Interval bounds are rounded outward.", "[interval]") {
+  using I = interval<double>;
+  REQUIRE_THROWS(I(2, 1));
+
+  // 0.1 and 0.2 are not exact, but their sum is contained.
+  I const a(0.1), b(0.2);
+  I const s = a + b;
+  REQUIRE(s.contains(0.1 + 0.2));
+  REQUIRE(s.lo < 0.1 + 0.2);
+  REQUIRE(s.hi > 0.1 + 0.2);
+  REQUIRE(s.width() < 1.0E-15);
+
+  I const d = I(1, 2) - I(3, 5);
+  REQUIRE(d.contains(-4));
+  REQUIRE(d.contains(-1));
+  REQUIRE(!d.contains(0));
+  REQUIRE((-d).lo == -d.hi);
+  REQUIRE((-d).contains(4));
+
+  // Product of intervals straddling zero.
+  I const p = I(-2, 3) * I(-5, 4);
+  REQUIRE(p.contains(-15));
+  REQUIRE(p.contains(12));
+  REQUIRE(p.lo > -15.001);
+  REQUIRE(p.hi < 12.001);
+
+  I const q = I(1) / I(3);
+  REQUIRE(q.lo < 1.0 / 3.0);
+  REQUIRE(q.hi > 1.0 / 3.0);
+  I const z = I(1) / I(-1, 1);
+  REQUIRE(std::isinf(z.lo));
+  REQUIRE(std::isinf(z.hi));
+
+  I const r = sqrt(I(2));
+  REQUIRE(r.contains(std::sqrt(2.0)));
+  REQUIRE(r.lo * r.lo < 2);
+  REQUIRE(r.hi * r.hi > 2);
+  REQUIRE(sqrt(I(-1, 4)).lo == 0);
+
+  // Even power of interval straddling zero is not negative.
+  REQUIRE(ipow(I(-2, 3), 2).lo == 0);
+  REQUIRE(ipow(I(-2, 3), 2).contains(9));
+  REQUIRE(ipow(I(-3, -2), 3).contains(-27));
+  REQUIRE(ipow(I(-3, -2), 3).contains(-8));
+  REQUIRE(ipow(I(-3, -2), 2).contains(4));
+  REQUIRE(ipow(I(-3, -2), 2).contains(9));
+  REQUIRE(ipow(I(-3, 2), 0) == I(1));
+  REQUIRE(ipow(I(2, 4), -1).contains(0.25));
+  REQUIRE(pow(I(0.1), 3.0).contains(0.1 * 0.1 * 0.1));
+  REQUIRE(pow(I(4, 9), 1.5).contains(8));
+  REQUIRE(pow(I(4, 9), 1.5).contains(27));
+
+  REQUIRE(I(1, 2) < I(3, 4));
+  REQUIRE(!(I(1, 3) < I(2, 4)));
+  REQUIRE(!(I(1, 3) > I(2, 4)));
+  REQUIRE(I(3, 4) >= I(1, 3));
+
+  std::ostringstream oss;
+  oss << I(1, 2);
+  REQUIRE(oss.str() == "[1, 2]");
+}
+
+
+TEST_CASE("Interval has dimension of quantity.", "[interval]") {
+  using namespace dbl;
+  auto const d = between(99.0 * m, 101.0 * m);
+  auto const t = between(19.0 * s, 21.0 * s);
+  auto const v = d / t;
+  speed const lv = lower(v), hv = upper(v);
+  REQUIRE(lv.raw_number() < 99.0 / 21.0);
+  REQUIRE(lv.raw_number() > 99.0 / 21.0 - 1.0E-12);
+  REQUIRE(hv.raw_number() > 101.0 / 19.0);
+
+  auto const a = d * d;
+  area const la = lower(a);
+  REQUIRE(la.raw_number() < 99.0 * 99.0);
+  auto const r = a.square_root();
+  REQUIRE(lower(r) < 99.0 * m);
+  REQUIRE(upper(r) > 101.0 * m);
+  auto const c = pow<3>(d);
+  REQUIRE((upper(c) / (m * m * m)).to_number() > 101.0 * 101.0 * 101.0);
+
+  auto const e = d + 1.0 * m;
+  REQUIRE(lower(e) < 100.0 * m);
+  REQUIRE(upper(e) > 102.0 * m);
+
+  dyndim const sd = 2.0 * s;
+  REQUIRE_THROWS(between(dyndim(1.0 * m), sd));
+  REQUIRE_THROWS(between(2.0 * m, 1.0 * m));
+}
+
+
+TEST_CASE("Interval batch bounds over arrays.", "[interval]") {
+  using namespace dbl;
+  using I            = interval<double>;
+  size_t const     n = 1000;
+  basic_interval_batch<double> x(n, length_dim), t(n, time_dim);
+  for (size_t i = 0; i < n; ++i) {
+    double const k = double(i) - 500.0;
+    x.set(i, between(k * 0.1 * m, (k * 0.1 + 0.3) * m));
+    t.set(i, between(0.3 * s, 0.7 * s));
+  }
+  REQUIRE_THROWS(x.set(0, between(2.0 * s, 3.0 * s)));
+
+  // Every batch operation agrees with the scalar operation.
+  auto const v = x / t;
+  REQUIRE(v.d() == speed::d());
+  REQUIRE(v.size() == n);
+  auto const p  = x * t;
+  auto const s2 = x + x;
+  auto const d2 = x - x * t / t;
+  auto const c  = ipow(x, 3);
+  auto const q  = ipow(x, 2);
+  auto const r  = sqrt(q);
+  REQUIRE(p.d() == length_dim + time_dim);
+  REQUIRE(c.d() == length_dim * dim::rat(3));
+  REQUIRE(r.d() == length_dim);
+  REQUIRE_THROWS(x - t);
+  for (size_t i = 0; i < n; i += 7) {
+    I const xi(x.lowers()[i], x.uppers()[i]), ti(t.lowers()[i], t.uppers()[i]);
+    REQUIRE(I(v.lowers()[i], v.uppers()[i]) == xi / ti);
+    REQUIRE(I(p.lowers()[i], p.uppers()[i]) == xi * ti);
+    REQUIRE(I(s2.lowers()[i], s2.uppers()[i]) == xi + xi);
+    REQUIRE(I(c.lowers()[i], c.uppers()[i]) == ipow(xi, 3));
+    REQUIRE(I(q.lowers()[i], q.uppers()[i]) == ipow(xi, 2));
+    REQUIRE(I(r.lowers()[i], r.uppers()[i]) == sqrt(ipow(xi, 2)));
+  }
+  REQUIRE(d2.d() == length_dim);
+  REQUIRE(x[3].d() == length_dim);
+
+  auto const y = ipow(t, -1);
+  REQUIRE(y.d() == time_dim * dim::rat(-1));
+  REQUIRE(I(y.lowers()[0], y.uppers()[0]).contains(1 / 0.3));
+  auto const one = ipow(x, 0);
+  REQUIRE(one.d() == nul_dim);
+  REQUIRE(one.lowers()[500] == 1);
+
+  REQUIRE_THROWS(x / basic_interval_batch<double>(3, time_dim));
+}
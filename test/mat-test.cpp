@@ -0,0 +1,135 @@
+/// @file       test/mat-test.cpp
+/// @brief      Test-cases for vnix::mv::mat.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+
+#include "../vnix/mv/mat.hpp"
+#include "../vnix/units.hpp"
+#include "catch.hpp"
+
+using namespace vnix::mv;
+using vnix::units::dimval;
+
+
+/// Require that product of matrix and its inverse be identity.
+template <typename T, size_t N>
+void check_inverse(mat<T, N, N> const &m, double tol = 1.0E-12) {
+  auto const p = m * inverse(m);
+  auto const q = inverse(m) * m;
+  for (size_t i = 0; i < N; ++i) {
+    for (size_t j = 0; j < N; ++j) {
+      double const e = (i == j ? 1 : 0);
+      REQUIRE(double(p(i, j)) == Approx(e).margin(tol));
+      REQUIRE(double(q(i, j)) == Approx(e).margin(tol));
+    }
+  }
+}
+
+
+TEST_CASE("Matrix is stored densely and accessed by row.", "[mat]") {
+  // No padding or over-alignment, so that a matrix is safe in std::vector.
+  REQUIRE(alignof(mat<float, 3, 3>) == alignof(float));
+  REQUIRE(sizeof(mat<float, 3, 3>) == 9 * sizeof(float));
+  REQUIRE(sizeof(mat<double, 3, 3>) == 9 * sizeof(double));
+  REQUIRE(sizeof(mat<char, 1, 3>) == 3);
+
+  mat<double, 2, 3> m;
+  m.row(0) = {1, 2, 3};
+  m.row(1) = {4, 5, 6};
+  m.col(2) = {7, 8};
+  REQUIRE(m(0, 2) == 7);
+  REQUIRE(m(1, 2) == 8);
+  REQUIRE(m.rows() == 2);
+  REQUIRE(m.cols() == 3);
+
+  mat<double, 3, 2> const t = transpose(m);
+  REQUIRE(t(2, 1) == 8);
+  REQUIRE(t(1, 0) == 2);
+  REQUIRE(transpose(t) == m);
+
+  REQUIRE((m + m)(1, 1) == 10);
+  REQUIRE((m - m)(1, 1) == 0);
+  REQUIRE((2 * m)(0, 1) == 4);
+  REQUIRE((m * 2.0)(0, 1) == 4);
+
+  mat<double, 2, 2> const p = m * t;
+  REQUIRE(p(0, 0) == 1 + 4 + 49);
+  REQUIRE(p(0, 1) == 4 + 10 + 56);
+  REQUIRE(p(1, 1) == 16 + 25 + 64);
+  REQUIRE(p(1, 0) == p(0, 1));
+}
+
+
+TEST_CASE("Determinant and inverse work for small matrices.", "[mat]") {
+  mat<double, 2, 2> const m2(4.0, 7.0, 2.0, 6.0);
+  REQUIRE(det(m2) == Approx(10));
+  check_inverse(m2);
+
+  mat<double, 3, 3> const m3(2.0, -1.0, 0.0, -1.0, 2.0, -1.0, 0.0, -1.0, 2.0);
+  REQUIRE(det(m3) == Approx(4));
+  check_inverse(m3);
+
+  mat<double, 4, 4> m4;
+  for (size_t i = 0; i < 4; ++i) {
+    for (size_t j = 0; j < 4; ++j) { m4(i, j) = 1.0 / (i + j + 1) + (i == j); }
+  }
+  REQUIRE(det(m4) == Approx(impl::lu<double, 4>(m4).det()));
+  check_inverse(m4);
+
+  // Zero in upper-left corner requires pivoting.
+  mat<double, 6, 6> m6;
+  for (size_t i = 0; i < 6; ++i) {
+    for (size_t j = 0; j < 6; ++j) { m6(i, j) = (i + 2 * j) % 7; }
+  }
+  REQUIRE(m6(0, 0) == 0);
+  check_inverse(m6, 1.0E-10);
+  REQUIRE(det(m6) == Approx(impl::lu<double, 6>(m6).det()));
+  mat<double, 6, 6> sw = m6; // Swap of two rows negates determinant.
+  for (size_t j = 0; j < 6; ++j) {
+    sw(0, j) = m6(3, j);
+    sw(3, j) = m6(0, j);
+  }
+  REQUIRE(det(sw) == Approx(-det(m6)));
+
+  mat<double, 3, 3> const sing(1.0, 2.0, 3.0, 2.0, 4.0, 6.0, 0.0, 1.0, 1.0);
+  REQUIRE(det(sing) == 0);
+}
+
+
+TEST_CASE("Matrix of quantities has dimensioned inverse.", "[mat]") {
+  using namespace vnix::units::dbl;
+  mat<length, 3, 3> a;
+  a.row(0) = {2 * m, 1 * m, 0 * m};
+  a.row(1) = {1 * m, 3 * m, 1 * m};
+  a.row(2) = {0 * m, 1 * m, 4 * m};
+  auto const d = det(a);
+  REQUIRE(d == 18 * m * m * m);
+  auto const i = inverse(a);
+  REQUIRE((i(0, 0) * (1 * m)).to_number() == Approx(11.0 / 18));
+  REQUIRE_THROWS(length(i(0, 0) * (1 * m)));
+
+  mat<length, 6, 6> b;
+  for (size_t r = 0; r < 6; ++r) {
+    for (size_t c = 0; c < 6; ++c) { b(r, c) = double((r + 2 * c) % 7) * m; }
+  }
+  auto const p = b * inverse(b);
+  REQUIRE(p(2, 2).to_number() == Approx(1));
+  REQUIRE(p(2, 3).to_number() == Approx(0).margin(1.0E-10));
+  REQUIRE_THROWS(length(det(b)));
+
+  col<force, 2> const f(1 * N, 2 * N);
+  row<length, 2> const x(3 * m, 4 * m);
+  auto const w = x * f;
+  REQUIRE(w(0, 0) == 11 * J);
+}
+
+
+TEST_CASE("Matrix of numbers works inside dimval.", "[mat]") {
+  using namespace vnix::units;
+  mat<double, 2, 2> const m(4.0, 7.0, 2.0, 6.0);
+  auto const              f = newtons(m);
+  auto const              c = 1 / f;
+  auto const              p = f * c;
+  REQUIRE(p.to_number()(0, 0) == Approx(1));
+  REQUIRE(p.to_number()(0, 1) == Approx(0).margin(1.0E-12));
+}
@@ -0,0 +1,92 @@
+/// @file       test/no-exceptions.cpp
+/// @brief      Program, compiled with -fno-exceptions, that checks that each
+///             error is reported to the handler installed by
+///             vnix::set_error_handler().
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+///
+/// Catch requires exceptions, and so this is a separate program, which exits
+/// with the number of failed checks.
+
+#include "../vnix/units.hpp"
+#include "../vnix/units/csv.hpp"
+#include "../vnix/units/pipeline.hpp"
+#include <cstring>
+#include <sstream>
+
+using namespace vnix;
+using namespace vnix::units;
+
+static_assert(!VNIX_EXCEPTIONS, "compile with -fno-exceptions");
+static_assert(noexcept(dbl::dyndim(1.0) + dbl::dyndim(1.0)), "noexcept");
+static_assert(noexcept(dbl::length() < dbl::length()), "noexcept");
+
+// A constant expression that fails is still diagnosed at compile-time; so
+// this would not compile:
+//
+//   constexpr auto bad = rat::rational<4, 2>(1, 0);
+
+static int failures = 0; ///< Number of failed checks.
+
+/// Print and count a failed check.
+#define CHECK(x)                                                               \
+  if (!(x)) {                                                                  \
+    std::fprintf(stderr, "%s:%d: failed: %s\n", __FILE__, __LINE__, #x);       \
+    ++failures;                                                                \
+  }
+
+/// True only if most recent error have message m.
+bool last_was(char const *m) {
+  char const *const e = last_error();
+  clear_error();
+  return e && std::strcmp(e, m) == 0;
+}
+
+
+int main() {
+  CHECK(set_error_handler(record_error) == abort_on_error);
+  CHECK(last_error() == nullptr);
+
+  // Rational and dimension.
+  rat::rational<4, 2> const zero(0);
+  CHECK(zero.reciprocal() == zero);
+  CHECK(last_was("attempt to take reciprocal of zero"));
+  rat::rational<4, 2>(1, 2).to_int();
+  CHECK(last_was("attempted conversion to integer from fraction"));
+
+  // Quantities.
+  using namespace dbl;
+  dyndim const x = 2.0 * m, t = 3.0 * s;
+  x + t;
+  CHECK(last_was("incompatible dimensions for addition"));
+  (void)(x < t); // Result is unspecified.
+  CHECK(last_was("incompatible dimensions for comparison"));
+  x.to_number();
+  CHECK(last_was("dimensioned quantity is not a number"));
+  length const l = t;
+  CHECK(last_was("attempt to construct from incompatible dimension"));
+  CHECK(x + x == 4.0 * m);
+  CHECK(last_error() == nullptr);
+
+  // Error in worker-thread is reported in calling thread.
+  std::istringstream few("a[m],b[s]\n1,2\n3\n");
+  basic_csv_reader<float>().read(few);
+  CHECK(last_was("too few fields in CSV row"));
+
+  using batch = basic_batch<float>;
+  basic_pipeline<float> p(1);
+  size_t                n = 0;
+  p.source([&](batch &b) {
+     b.d = time_dim;
+     b.v.assign(8, 1.0f);
+     return ++n < 1000;
+   })
+      .stage(length_dim, [](batch &) { return true; });
+  p.run();
+  CHECK(last_was("batch of wrong dimension for stage"));
+  CHECK(n < 1000);
+
+  set_error_handler(abort_on_error);
+  (void)l;
+  return failures;
+}
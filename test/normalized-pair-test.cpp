@@ -38,3 +38,25 @@ TEST_CASE("Limits are as expected.", "[normalized-pair]") {
   REQUIRE_NOTHROW(normalized_pair(+1, 8));
   REQUIRE_THROWS(normalized_pair(+1, 9));
 }
+
+
+TEST_CASE("Pair in lowest terms is only checked.", "[normalized-pair]") {
+  using lt = normalized_pair::lowest_terms;
+  normalized_pair const p(-3, 8, lt());
+  REQUIRE(p.n() == -3);
+  REQUIRE(p.d() == +8);
+
+  REQUIRE_NOTHROW(normalized_pair(-16, 1, lt()));
+  REQUIRE_THROWS(normalized_pair(-17, 1, lt()));
+  REQUIRE_THROWS(normalized_pair(+16, 1, lt()));
+  REQUIRE_THROWS(normalized_pair(+1, 9, lt()));
+}
+
+
+TEST_CASE("Negative numerator is reduced in wide type.", "[normalized-pair]") {
+  // The fast types for normalized_pair<9, 7> are 64 bits wide on common
+  // platforms.
+  vnix::rat::normalized_pair<9, 7> const p(-9, 6);
+  REQUIRE(p.n() == -3);
+  REQUIRE(p.d() == +2);
+}
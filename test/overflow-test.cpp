@@ -0,0 +1,66 @@
+/// @file       test/overflow-test.cpp
+/// @brief      Test-cases for vnix::add_overflow etc.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+
+#include "../vnix/overflow.hpp"
+#include "catch.hpp"
+#include <cstdint> // for int8_t etc.
+
+using namespace vnix;
+
+
+/// Sum, or -1 on overflow.
+constexpr int checked_sum(int a, int b) {
+  int r = 0;
+  return add_overflow(a, b, &r) ? -1 : r;
+}
+
+
+TEST_CASE("Sum is checked for overflow.", "[overflow]") {
+  int8_t r = 0;
+  REQUIRE(!add_overflow<int8_t>(100, 27, &r));
+  REQUIRE(r == 127);
+  REQUIRE(add_overflow<int8_t>(100, 28, &r));
+  REQUIRE(!add_overflow<int8_t>(-100, -28, &r));
+  REQUIRE(r == -128);
+  REQUIRE(add_overflow<int8_t>(-100, -29, &r));
+
+  uint8_t u = 0;
+  REQUIRE(!add_overflow<uint8_t>(200, 55, &u));
+  REQUIRE(u == 255);
+  REQUIRE(add_overflow<uint8_t>(200, 56, &u));
+}
+
+
+TEST_CASE("Difference is checked for overflow.", "[overflow]") {
+  int8_t r = 0;
+  REQUIRE(!sub_overflow<int8_t>(-100, 28, &r));
+  REQUIRE(r == -128);
+  REQUIRE(sub_overflow<int8_t>(-100, 29, &r));
+  REQUIRE(sub_overflow<int8_t>(0, -128, &r));
+
+  uint8_t u = 0;
+  REQUIRE(!sub_overflow<uint8_t>(3, 3, &u));
+  REQUIRE(u == 0);
+  REQUIRE(sub_overflow<uint8_t>(3, 4, &u));
+}
+
+
+TEST_CASE("Product is checked for overflow.", "[overflow]") {
+  int64_t r = 0;
+  REQUIRE(!mul_overflow<int64_t>(int64_t(1) << 31, int64_t(1) << 31, &r));
+  REQUIRE(r == int64_t(1) << 62);
+  REQUIRE(mul_overflow<int64_t>(int64_t(1) << 32, int64_t(1) << 31, &r));
+  REQUIRE(!mul_overflow<int64_t>(-(int64_t(1) << 32), int64_t(1) << 31, &r));
+  REQUIRE(r == INT64_MIN);
+  REQUIRE(mul_overflow<int64_t>(-1, INT64_MIN, &r));
+  REQUIRE(!mul_overflow<int64_t>(0, INT64_MIN, &r));
+  REQUIRE(r == 0);
+}
+
+
+TEST_CASE("Check is allowed in constant expression.", "[overflow]") {
+  static_assert(checked_sum(2, 3) == 5, "sum");
+  static_assert(checked_sum(INT32_MAX, 1) == -1, "overflow");
+}
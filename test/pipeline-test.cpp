@@ -0,0 +1,88 @@
+/// @file       test/pipeline-test.cpp
+/// @brief      Test-cases for vnix::units::basic_pipeline.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+
+#include "../vnix/units/pipeline.hpp"
+#include "../vnix/units.hpp"
+#include "../vnix/units/converter.hpp"
+#include "catch.hpp"
+#include <cstring> // for strcmp
+
+using namespace vnix::units;
+
+
+TEST_CASE("Pipeline decodes, converts, filters, and sums.", "[pipeline]") {
+  using namespace dbl;
+  using batch = basic_batch<double>;
+  size_t const            nb = 100; // Number of batches.
+  size_t const            ne = 64;  // Number of elements per batch.
+  basic_converter<double> ft_to_base(ft, m);
+  double                  total  = 0;
+  size_t                  n_sink = 0;
+
+  basic_pipeline<double> p(2);
+  p.source([&](batch &b) {
+     if (b.seq == nb) { return false; }
+     b.d = nul_dim; // Decoded count of feet.
+     for (size_t i = 0; i < ne; ++i) { b.v.push_back(double(i % 3)); }
+     return true;
+   })
+      .stage(nul_dim,
+             [&](batch &b) {
+               ft_to_base.apply(b.v.data(), b.v.size());
+               b.d = ft_to_base.d();
+               return true;
+             })
+      .stage(length_dim, [](batch &b) { return b.seq % 2 == 0; }, 3)
+      .stage(length_dim, [&](batch &b) {
+        auto const s = b.as<length_dim.encode()>();
+        for (size_t i = 0; i < s.size(); ++i) {
+          total += (s[i] / m).to_number();
+        }
+        ++n_sink;
+        return true;
+      });
+  p.run();
+
+  REQUIRE(n_sink == nb / 2);
+  // Each batch holds 64 elements, 21 of 1 ft and 21 of 2 ft.
+  REQUIRE(total == Approx(0.3048 * 63 * (nb / 2)));
+}
+
+
+TEST_CASE("Pipeline checks dimension once per batch.", "[pipeline]") {
+  using batch = basic_batch<float>;
+  basic_pipeline<float> p(1);
+  size_t                n = 0;
+  p.source([&](batch &b) {
+     b.d = time_dim;
+     b.v.assign(8, 1.0f);
+     return ++n < 1000;
+   })
+      .stage(length_dim, [](batch &) { return true; });
+  try {
+    p.run();
+    FAIL("expected exception");
+  } catch (char const *e) {
+    REQUIRE(std::strcmp(e, "batch of wrong dimension for stage") == 0);
+  }
+  REQUIRE(n < 1000); // Source stopped early.
+}
+
+
+TEST_CASE("Pipeline propagates exception from stage.", "[pipeline]") {
+  using batch = basic_batch<double>;
+  basic_pipeline<double> p;
+  REQUIRE_THROWS(p.run());
+  p.source([](batch &b) {
+    b.v.assign(4, 2.0);
+    return b.seq < 10;
+  });
+  REQUIRE_THROWS(p.run());
+  p.stage(nul_dim, [](batch &b) {
+    if (b.seq == 5) { throw "bad batch"; }
+    return true;
+  });
+  REQUIRE_THROWS_WITH(p.run(), "bad batch");
+}
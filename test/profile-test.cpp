@@ -0,0 +1,75 @@
+/// @file       test/profile-test.cpp
+/// @brief      Test-cases for vnix::units::profiler.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+
+#define VNIX_UNITS_PROFILE
+#include "../vnix/units/profile.hpp"
+#include "catch.hpp"
+#include <sstream>
+#include <string>
+
+using namespace vnix::units;
+
+
+namespace {
+
+
+/// Function with two sites, one of which sees two dimensions.
+dbl::dyndim f(dbl::dyndim const &x, dbl::dyndim const &t, int i) {
+  dbl::dyndim const v = VNIX_UNITS_SITE(x / t);
+  if (i % 4 == 0) { return VNIX_UNITS_SITE(i % 8 ? v : x); }
+  return v;
+}
+
+
+} // namespace
+
+
+TEST_CASE("Profiler ranks sites and proposes statdim.", "[profile]") {
+  using namespace dbl;
+  profiler::reset();
+  for (int i = 0; i < 16; ++i) { f(2.0 * m, 4.0 * s, i); }
+  auto const r = profiler::sites();
+  REQUIRE(r.size() == 2);
+
+  REQUIRE(r[0].calls == 16);
+  REQUIRE(r[0].candidate());
+  REQUIRE(r[0].dims[0].first == speed::d());
+  REQUIRE(r[0].suggestion == "dbl::speed");
+  REQUIRE(std::string(r[0].file).find("profile-test.cpp") != std::string::npos);
+
+  REQUIRE(r[1].calls == 4);
+  REQUIRE(!r[1].candidate());
+  REQUIRE(r[1].dims.size() == 2);
+  REQUIRE(r[1].suggestion.empty());
+  REQUIRE(r[1].line == r[0].line + 1);
+
+  std::ostringstream oss;
+  profiler::report(oss);
+  std::string const s = oss.str();
+  REQUIRE(s.find("16 ") == 0);
+  REQUIRE(s.find("candidate dbl::speed\n") != std::string::npos);
+  REQUIRE(s.find("4 ") == s.find('\n') + 1);
+  REQUIRE(s.find(" mixed [m]x2 [m s^-1]x2\n") != std::string::npos);
+
+  profiler::reset();
+  REQUIRE(profiler::sites().empty());
+}
+
+
+TEST_CASE("Profiler names number and unnamed dimension.", "[profile]") {
+  using namespace flt;
+  profiler::reset();
+  dyndim const n = VNIX_UNITS_SITE(dyndim(3.0f * m / m));
+  dyndim const j = VNIX_UNITS_SITE(dyndim(3.0f * m * s));
+  auto const   r = profiler::sites();
+  REQUIRE(r.size() == 2);
+  // Sites with the same number of calls are in order of line.
+  REQUIRE(r[0].line < r[1].line);
+  REQUIRE(r[0].suggestion == "float");
+  REQUIRE(r[1].suggestion.find("basic_statdim<") == 0);
+  profiler::reset();
+  (void)n;
+  (void)j;
+}
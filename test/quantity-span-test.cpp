@@ -0,0 +1,38 @@
+/// @file       test/quantity-span-test.cpp
+/// @brief      Test-cases for vnix::units::statdim_span and dyndim_span.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+
+#include "../vnix/units.hpp"
+#include "../vnix/units/quantity-span.hpp"
+#include "catch.hpp"
+
+using namespace vnix::units;
+
+
+TEST_CASE("statdim_span accesses numbers as quantities.", "[quantity-span]") {
+  using namespace flt;
+  float                                     a[] = {1, 2, 3};
+  statdim_span<length::d().encode(), float> s(a, 3);
+  REQUIRE(s.size() == 3);
+  REQUIRE(s[1] == 2 * m);
+  s.set(2, 5.0_km);
+  REQUIRE(a[2] == 5000);
+  REQUIRE(s.subspan(1, 2)[1] == 5 * km);
+}
+
+
+TEST_CASE("dyndim_span checks dimension once.", "[quantity-span]") {
+  using namespace dbl;
+  double                     a[] = {4, 5};
+  dyndim_span<double>       sp(a, 2, (m / s).d());
+  dyndim_span<double const> c = sp;
+  REQUIRE(c[0] == 4 * m / s);
+  REQUIRE_THROWS(sp.set(0, 3 * m));
+  REQUIRE_NOTHROW(sp.set(0, 3 * m / s));
+  REQUIRE(a[0] == 3);
+  REQUIRE_NOTHROW(sp.as<speed::d().encode()>());
+  REQUIRE_THROWS(sp.as<length::d().encode()>());
+  speed v = sp.as<speed::d().encode()>()[1];
+  REQUIRE(v == 5 * m / s);
+}
@@ -83,6 +83,24 @@ TEST_CASE("Multiplication and division work.", "[rational]") {
 }
 
 
+TEST_CASE("Multiplication works for wide negative numerator.", "[rational]") {
+  // Each fast integer-type here is 64 bits wide on common platforms, and the
+  // gcd of a negative numerator and a denominator is unsigned.
+  REQUIRE(rat32_t(-6, 35) * rat32_t(7, 4) == rat32_t(-3, 10));
+  REQUIRE(rat64_t(-3, 4) * rat64_t(2, 9) == rat64_t(-1, 6));
+  REQUIRE(rat64_t(-3, 4) / rat64_t(-9, 2) == rat64_t(1, 6));
+  constexpr auto r = rat32_t(-6, 35) * rat32_t(7, 4);
+  static_assert(r == rat32_t(-3, 10), "constexpr product");
+}
+
+
+TEST_CASE("Overflow of product is detected.", "[rational]") {
+  using rat = rat::rational<40, 24>;
+  rat const big(rat::stype(1) << 38);
+  REQUIRE_THROWS(big * big);
+}
+
+
 TEST_CASE("Encoding and decoding work as expected.", "[rational]") {
   rat8_t  r1(-3, 4);
   uint8_t code = 0xE8 | 0x03;
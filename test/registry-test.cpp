@@ -0,0 +1,102 @@
+/// @file       test/registry-test.cpp
+/// @brief      Test-cases for vnix::units::unit_registry.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+
+#include "../vnix/units/registry.hpp"
+#include "catch.hpp"
+#include <fstream>
+#include <sstream>
+
+using namespace vnix::units;
+
+
+/// Basis identical to that in units.yml.
+static char const *const basis = R"(---
+basis:
+  - {dim: length,      ctor: meters,   sym: m, scales: [c,m,mu,n,p,f,k,M]}
+  - {dim: mass,        ctor: grams,    sym: g, scales: [m,mu,n,p,k,M]}
+  - {dim: time,        ctor: seconds,  sym: s, scales: [m,mu,n,p,f]}
+  - {dim: charge,      ctor: coulombs, sym: C, scales: [m,mu,n,p]}
+  - {dim: temperature, ctor: kelvins,  sym: K, scales: [m,mu,n]}
+)";
+
+
+TEST_CASE("Registry adds unit without recompiling.", "[registry]") {
+  std::istringstream is(std::string(basis) + R"(
+derivatives:
+  units:
+    - {ctor: feet,     sym: ft  = 0.3048*m, scales: [k]}  # comment
+    - {ctor: furlongs, sym: fur = 660*ft,   scales: []}
+    - {ctor: newtons,  sym: N   = kg*m/s/s, scales: [m,k]}
+  dims:
+    - speed = decltype(m/s)
+    - force = decltype(N/1)
+)");
+  unit_registry const r(is);
+  REQUIRE(r.num_units() == 37);
+  REQUIRE(r.num_dims() == 7);
+
+  unit_spec const *fur = r.find_unit("fur");
+  REQUIRE(fur);
+  REQUIRE(fur->sf == Approx(201.168));
+  REQUIRE(fur->d == length_dim);
+  REQUIRE(r.find_unit("kft")->sf == Approx(304.8));
+  REQUIRE(r.find_unit("mN")->sf == Approx(1));
+  REQUIRE(r.find_unit("mi") == nullptr);
+
+  REQUIRE(*r.find_dim("speed") == dbl::speed::d());
+  REQUIRE(*r.find_dim("force") == dbl::force::d());
+  REQUIRE(*r.find_dim("mass") == mass_dim);
+  REQUIRE(r.find_dim("energy") == nullptr);
+
+  unit_spec const u = r.unit("fur/s");
+  REQUIRE(u.d == dbl::speed::d());
+  REQUIRE(u.sf == Approx(201.168));
+  REQUIRE_THROWS(r.unit("mi/s"));
+}
+
+
+TEST_CASE("Registry rejects incompatible basis.", "[registry]") {
+  std::istringstream is1(R"(basis:
+  - {dim: length, ctor: meters, sym: m, scales: []}
+)");
+  REQUIRE_THROWS(unit_registry(is1));
+
+  std::istringstream is2(R"(basis:
+  - {dim: mass, ctor: grams, sym: g, scales: []}
+)");
+  REQUIRE_THROWS(unit_registry(is2));
+
+  std::istringstream is3(std::string(basis) + R"(derivatives:
+  units:
+    - {ctor: bogus, sym: bog = 2*xyz, scales: []}
+)");
+  REQUIRE_THROWS(unit_registry(is3));
+
+  std::istringstream is4(std::string(basis) + R"(derivatives:
+  units:
+    - {ctor: feet, sym: ft = 0.3048*m, scales: [Q]}
+)");
+  REQUIRE_THROWS(unit_registry(is4));
+}
+
+
+TEST_CASE("Registry from units.yml agrees with compiled units.",
+          "[registry]") {
+  std::ifstream is("../units.yml");
+  if (!is) {
+    WARN("cannot open ../units.yml");
+    return;
+  }
+  unit_registry const r(is);
+  REQUIRE(r.num_units() == num_unit_syms);
+  for (auto const &s : unit_syms) {
+    unit_spec const *u = r.find_unit(s.sym);
+    REQUIRE(u);
+    REQUIRE(u->sf == Approx(s.sf));
+    REQUIRE(u->d.encode() == s.d);
+  }
+  REQUIRE(*r.find_dim("pressure") == dbl::pressure::d());
+  REQUIRE(*r.find_dim("energy") == dbl::energy::d());
+}
@@ -0,0 +1,106 @@
+/// @file       test/sort-test.cpp
+/// @brief      Test-cases for sorting and selection of spans of quantities.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+
+#include "../vnix/units/sort.hpp"
+#include "../vnix/units.hpp"
+#include "catch.hpp"
+#include <random>
+
+using namespace vnix::units;
+
+
+/// Random numbers, including negative numbers, zeros, and infinities.
+/// @tparam T  Type of number.
+/// @param  n  Number of numbers.
+template <typename T> std::vector<T> random_numbers(size_t n) {
+  std::mt19937                      gen(7);
+  std::uniform_real_distribution<T> u(-1.0E+06, 1.0E+06);
+  std::vector<T>                    x(n);
+  for (auto &e : x) { e = u(gen); }
+  x[0] = 0;
+  x[1] = std::numeric_limits<T>::infinity();
+  x[2] = -std::numeric_limits<T>::infinity();
+  x[3] = std::numeric_limits<T>::denorm_min();
+  x[4] = -1.0E-30;
+  return x;
+}
+
+
+TEST_CASE("Radix-sort agrees with std::sort.", "[sort]") {
+  for (size_t n : {0, 1, 10, 300, 5000}) {
+    auto d  = random_numbers<double>(n + 5);
+    auto f  = random_numbers<float>(n + 5);
+    auto ds = d;
+    auto fs = f;
+    sort(dyndim_span<double>(d.data(), d.size(), length_dim));
+    sort(statdim_span<time_dim.encode(), float>(f.data(), f.size()));
+    std::sort(ds.begin(), ds.end());
+    std::sort(fs.begin(), fs.end());
+    REQUIRE(d == ds);
+    REQUIRE(f == fs);
+  }
+}
+
+
+TEST_CASE("Parallel sort agrees with std::sort.", "[sort]") {
+  auto x  = random_numbers<double>(300000);
+  auto xs = x;
+  std::sort(xs.begin(), xs.end());
+  parallel_sort(dyndim_span<double>(x.data(), x.size(), length_dim), 3);
+  REQUIRE(x == xs);
+
+  std::vector<long double> y = {3, 1, 2};
+  parallel_sort(dyndim_span<long double>(y.data(), y.size(), mass_dim), 4);
+  REQUIRE(y == std::vector<long double>({1, 2, 3}));
+}
+
+
+TEST_CASE("Sort-order is stable permutation.", "[sort]") {
+  std::vector<double> x = {3, 1, 2, 1, -5};
+  auto const o = sort_order(dyndim_span<double>(x.data(), 5, nul_dim));
+  REQUIRE(o == std::vector<size_t>({4, 1, 3, 2, 0}));
+  auto const big = random_numbers<float>(1000);
+  auto const ob =
+      sort_order(dyndim_span<float const>(big.data(), 1000, nul_dim));
+  for (size_t i = 1; i < ob.size(); ++i) {
+    REQUIRE(big[ob[i - 1]] <= big[ob[i]]);
+  }
+}
+
+
+TEST_CASE("Selection and partition check dimension once.", "[sort]") {
+  using namespace dbl;
+  std::vector<double> x = {5000, 1000, 4000, 2000, 3000};
+  dyndim_span<double> sp(x.data(), x.size(), length_dim);
+
+  nth_element(sp, 2);
+  REQUIRE(sp[2] == 3 * km);
+
+  REQUIRE(partition(sp, 2500 * m) == 2);
+  REQUIRE(sp[0] < 2500 * m);
+  REQUIRE(sp[1] < 2500 * m);
+  REQUIRE(sp[2] > 2500 * m);
+  REQUIRE_THROWS(partition(sp, 3 * s));
+
+  auto const top = top_k(sp, 2);
+  REQUIRE(top.size() == 2);
+  REQUIRE(top[0] == 5 * km);
+  REQUIRE(top[1] == 4 * km);
+
+  auto const t3 = top_k(sp.as<length_dim.encode()>(), 10);
+  REQUIRE(t3.size() == 5);
+  REQUIRE(t3[4] == 1 * km);
+}
+
+
+TEST_CASE("Vector of dyndims is sorted after one check of dims.", "[sort]") {
+  using namespace dbl;
+  std::vector<dyndim> v = {3 * m, 1 * km, 2 * mm};
+  sort(v);
+  REQUIRE(v[0] == 2 * mm);
+  REQUIRE(v[2] == 1 * km);
+  v.push_back(1 * s);
+  REQUIRE_THROWS(sort(v));
+}
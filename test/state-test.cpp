@@ -0,0 +1,103 @@
+/// @file       test/state-test.cpp
+/// @brief      Test-cases for vnix::units::basic_state_vec and basic_state_mat.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+
+#include "../vnix/units/state.hpp"
+#include "../vnix/units.hpp"
+#include "catch.hpp"
+#include <type_traits>
+
+using namespace vnix::units;
+using namespace vnix::units::dbl;
+
+using pv   = state_vec<length, speed>; ///< Position and velocity.
+using pcov = covariance<pv>;           ///< Covariance of pv.
+
+
+TEST_CASE("State vector has per-element dimension.", "[state]") {
+  pv const x(3 * m, 2 * m / s);
+  REQUIRE(x.get<0>() == 3 * m);
+  REQUIRE(x.get<1>() == 2 * m / s);
+  REQUIRE(x[1].d() == speed::d());
+  REQUIRE(x[0] == 3 * m);
+
+  pv y = x + x;
+  y.set<1>(5 * m / s);
+  REQUIRE(y.get<0>() == 6 * m);
+  REQUIRE(y.get<1>() == 5 * m / s);
+  REQUIRE((y - x).get<1>() == 3 * m / s);
+  REQUIRE((x * 0.5).get<0>() == 1.5 * m);
+
+  REQUIRE_THROWS(pv(dyndim(1 * s), 2 * m / s));
+  using sp = basic_statdim<speed::d().encode(), double>;
+  static_assert(std::is_same<pv::elem<1>, sp>::value, "element type");
+}
+
+
+TEST_CASE("Kalman prediction and update keep dimensions.", "[state]") {
+  auto const dt = 0.5 * s;
+
+  state_map<pv, pv> f = state_map<pv, pv>::identity();
+  f.set<0, 1>(dt);
+  static_assert(
+      std::is_same<state_map<pv, pv>::elem<1, 0>,
+                   basic_statdim<(nul_dim - time_dim).encode(), double>>::value,
+      "element of transition is frequency");
+
+  pv const x0(1 * m, 2 * m / s);
+  pv const x1 = f * x0;
+  REQUIRE(x1.get<0>() == 2 * m);
+  REQUIRE(x1.get<1>() == 2 * m / s);
+
+  pcov p = pcov::zero();
+  p.set<0, 0>(4 * m * m);
+  p.set<1, 1>(1 * m * m / s / s);
+  auto const pp = f * p * transpose(f);
+  static_assert(std::is_same<decltype(pp), pcov const>::value, "covariance");
+  REQUIRE(pp.get<0, 0>() == 4.25 * m * m);
+  REQUIRE(pp.get<0, 1>() == 0.5 * m * m / s);
+  REQUIRE(pp(1, 0) == 0.5 * m * m / s);
+  REQUIRE(pp(1, 0).d() == (length_dim + speed::d()));
+
+  // Measurement of position only.
+  using pos = state_vec<length>;
+  state_map<pos, pv> h = state_map<pos, pv>::zero();
+  h.set<0, 0>(1);
+  covariance<pos> r = covariance<pos>::zero();
+  r.set<0, 0>(0.25 * m * m);
+  auto const sc = h * pp * transpose(h) + r;
+  auto const k  = pp * transpose(h) * inverse(sc);
+  static_assert(std::is_same<decltype(k)::elem<1, 0>,
+                             basic_statdim<(nul_dim - time_dim).encode(),
+                                           double>>::value,
+                "gain for speed from position is frequency");
+  REQUIRE(k.get<0, 0>() == Approx(4.25 / 4.5));
+  REQUIRE(k.get<1, 0>().raw_number() == Approx(0.5 / 4.5));
+
+  pos const  z(2.5 * m);
+  pv const   x2 = x1 + k * (z - h * x1);
+  auto const p2 = (state_map<pv, pv>::identity() - k * h) * pp;
+  REQUIRE(x2.get<0>().raw_number() == Approx(2 + 0.5 * 4.25 / 4.5));
+  REQUIRE(p2.get<0, 0>().raw_number() < 4.25);
+
+  auto const o = outer(x0, x0);
+  static_assert(std::is_same<decltype(o), pcov const>::value, "outer");
+  REQUIRE(o.get<0, 1>() == 2 * m * m / s);
+}
+
+
+TEST_CASE("Six-element state has 6x6 covariance.", "[state]") {
+  using st = state_vec<length, length, length, speed, speed, speed>;
+  covariance<st> p = covariance<st>::zero();
+  for (size_t i = 0; i < 6; ++i) { p.raw()(i, i) = double(i + 1); }
+  p.set<0, 3>(0.5 * m * m / s);
+  p.set<3, 0>(0.5 * m * m / s);
+  auto const q = inverse(p) * p;
+  for (size_t i = 0; i < 6; ++i) {
+    for (size_t j = 0; j < 6; ++j) {
+      REQUIRE(q.raw()(i, j) == Approx(i == j).margin(1.0E-12));
+      REQUIRE(q(i, j).d() == (dim(st::dims::at(j)) - dim(st::dims::at(i))));
+    }
+  }
+}
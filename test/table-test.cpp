@@ -0,0 +1,60 @@
+/// @file       test/table-test.cpp
+/// @brief      Test-cases for vnix::units::basic_table.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+
+#include "../vnix/units.hpp"
+#include "../vnix/units/table.hpp"
+#include "catch.hpp"
+
+using namespace vnix::units;
+
+
+TEST_CASE("Table rejects bad schema and bad rows.", "[table]") {
+  using namespace dbl;
+  using table = basic_table<double>;
+  REQUIRE_THROWS(table({{"x", length_dim}, {"x", time_dim}}));
+  table t({column_spec::of<dbl::time>("t"), column_spec::of<speed>("v")});
+  REQUIRE(t.cols() == 2);
+  REQUIRE_NOTHROW(t.append({2.0_s, 3 * m / s}));
+  REQUIRE_THROWS(t.append({3 * m / s, 2.0_s}));
+  REQUIRE_THROWS(t.append({2.0_s}));
+  REQUIRE(t.rows() == 1);
+  REQUIRE_THROWS(t.index("x"));
+}
+
+
+TEST_CASE("Table projects columns without copying.", "[table]") {
+  using namespace flt;
+  using table = basic_table<float>;
+  table t({column_spec::of<flt::time>("t"), column_spec::of<pressure>("p")});
+  for (int i = 0; i < 10; ++i) { t.append({i * s, i * N / m / m}); }
+  REQUIRE(t.rows() == 10);
+  REQUIRE(t.at(3, 1) == 3 * N / m / m);
+
+  auto p = t.column<pressure>("p");
+  REQUIRE(p.size() == 10);
+  REQUIRE(p[7] == 7 * N / m / m);
+  p.set(7, 1.0_N / m / m);
+  REQUIRE(t.at(7, 1) == 1 * N / m / m);
+  REQUIRE(t.column(1).data() == p.data());
+  REQUIRE_THROWS(t.column<speed>("p"));
+}
+
+
+TEST_CASE("Table appends batch of columns.", "[table]") {
+  using namespace dbl;
+  using table = basic_table<double>;
+  table  t({column_spec::of<length>("x"), column_spec::of<force>("F")});
+  double x[] = {1, 2, 3};
+  double f[] = {4000, 5000, 6000};
+  t.append({dyndim_span<double const>(x, 3, length_dim),
+            dyndim_span<double const>(f, 3, force::d())});
+  REQUIRE(t.rows() == 3);
+  REQUIRE(t.at(2, 1) == 6 * N);
+  REQUIRE_THROWS(t.append({dyndim_span<double const>(x, 3, force::d()),
+                           dyndim_span<double const>(f, 3, force::d())}));
+  REQUIRE_THROWS(t.append({dyndim_span<double const>(x, 2, length_dim),
+                           dyndim_span<double const>(f, 3, force::d())}));
+  REQUIRE(t.rows() == 3);
+}
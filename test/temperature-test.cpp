@@ -0,0 +1,121 @@
+/// @file       test/temperature-test.cpp
+/// @brief      Test-cases for vnix::units::basic_abs_temperature and for
+///             conversion of readings of temperature.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+
+#include "../vnix/units/temperature.hpp"
+#include "../vnix/units.hpp"
+#include "catch.hpp"
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace vnix::units;
+
+
+/// True only if A + B be well formed.
+template <typename A, typename B, typename = void>
+struct can_add : std::false_type {};
+
+template <typename A, typename B>
+struct can_add<A, B,
+               decltype(void(std::declval<A>() + std::declval<B>()))>
+    : std::true_type {};
+
+/// True only if A * B be well formed.
+template <typename A, typename B, typename = void>
+struct can_mul : std::false_type {};
+
+template <typename A, typename B>
+struct can_mul<A, B,
+               decltype(void(std::declval<A>() * std::declval<B>()))>
+    : std::true_type {};
+
+
+TEST_CASE("Absolute temperature converts among scales.", "[temperature]") {
+  using namespace dbl;
+  REQUIRE(celsius(0.0).from_zero().raw_number() == Approx(273.15));
+  REQUIRE(celsius(100.0).in<fahrenheit_scale>() == Approx(212));
+  REQUIRE(fahrenheit(-40.0).in<celsius_scale>() == Approx(-40));
+  REQUIRE(fahrenheit(32.0).in<kelvin_scale>() == Approx(273.15));
+  REQUIRE(rankine(0.0).from_zero() == 0 * K);
+  REQUIRE(rankine(491.67).in<celsius_scale>() == Approx(0).margin(1E-12));
+  abs_temperature const t(300 * K);
+  REQUIRE(t.in<celsius_scale>() == Approx(26.85));
+  REQUIRE(t.in<rankine_scale>() == Approx(540));
+
+  // Readings on every scale agree at compile-time.
+  constexpr auto f = fahrenheit(212.0L);
+  static_assert(f.in<celsius_scale>() > 99.999L, "212 F");
+  static_assert(f.in<celsius_scale>() < 100.001L, "212 F");
+}
+
+
+TEST_CASE("Points and differences of temperature are distinct.",
+          "[temperature]") {
+  using namespace dbl;
+  using P = abs_temperature;
+
+  // Difference of points is an interval; point and interval make a point.
+  P const a = celsius(20.0), b = celsius(25.0);
+  temperature const d = b - a;
+  REQUIRE(d.raw_number() == Approx(5));
+  REQUIRE((a + d).in<celsius_scale>() == Approx(25));
+  REQUIRE((d + a) == (a + d));
+  REQUIRE((b - d).in<celsius_scale>() == Approx(20));
+  REQUIRE(a < b);
+  REQUIRE(b >= a);
+  REQUIRE(a != b);
+
+  // A difference in Fahrenheit is smaller than one in Celsius.
+  P c = fahrenheit(50.0);
+  c += fahrenheit_diff(18.0);
+  REQUIRE(c.in<fahrenheit_scale>() == Approx(68));
+  REQUIRE(c.in<celsius_scale>() == Approx(20));
+  c -= celsius_diff(10.0);
+  REQUIRE(c.in<celsius_scale>() == Approx(10));
+
+  // An interval whose dimension is known only at run-time is checked then.
+  dyndim const dk = 5 * K, dm = 5 * m;
+  REQUIRE((c + dk).in<celsius_scale>() == Approx(15));
+  REQUIRE_THROWS(c + dm);
+
+  // Neither sum nor multiple of absolute temperatures compiles.
+  static_assert(!can_add<P, P>::value, "sum of absolute temperatures");
+  static_assert(!can_mul<P, double>::value, "multiple of abs. temperature");
+  static_assert(can_add<P, temperature>::value, "point plus interval");
+  static_assert(!can_add<P, length>::value, "point plus length");
+  static_assert(!can_add<P, double>::value, "point plus number");
+}
+
+
+TEST_CASE("Readings convert in bulk.", "[temperature]") {
+  // Length not a multiple of the block exercises the partial block.
+  size_t const       n = 1000 + 3;
+  std::vector<float> c(n), f(n), k(n), back(n);
+  for (size_t i = 0; i < n; ++i) { c[i] = -50.0f + 0.1f * i; }
+  statdim_span<temperature_dim.encode(), float> ks(k.data(), n);
+  to_kelvins<celsius_scale>(c.data(), ks);
+  from_kelvins<fahrenheit_scale>(ks, f.data());
+  statdim_span<temperature_dim.encode(), float const> cks = ks;
+  from_kelvins<celsius_scale>(cks, back.data());
+  // The blocked path and the scalar path agree only up to rounding, because
+  // the compiler may contract either, but not both, into a fused multiply-add.
+  for (size_t i = 0; i < n; i += 97) {
+    REQUIRE(k[i] == Approx(celsius(c[i]).from_zero().raw_number()));
+    REQUIRE(f[i] == Approx(celsius(c[i]).in<fahrenheit_scale>()));
+    REQUIRE(f[i] == Approx(c[i] * 1.8f + 32).margin(1E-3));
+    REQUIRE(back[i] == Approx(c[i]).margin(1E-3));
+  }
+
+  // Conversion in place.
+  std::vector<double> x = {32, 212, -459.67};
+  statdim_span<temperature_dim.encode(), double> xs(x.data(), x.size());
+  to_kelvins<fahrenheit_scale>(x.data(), xs);
+  REQUIRE(x[0] == Approx(273.15));
+  REQUIRE(x[1] == Approx(373.15));
+  REQUIRE(x[2] == Approx(0).margin(1E-12));
+  to_kelvins<kelvin_scale>(x.data(), xs.subspan(0, 0));
+  REQUIRE(x[0] == Approx(273.15));
+}
@@ -0,0 +1,117 @@
+/// @file       test/uncertain-test.cpp
+/// @brief      Test-cases for vnix::units::uncertain.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+
+#include "../vnix/units/uncertain.hpp"
+#include "../vnix/units.hpp"
+#include "catch.hpp"
+#include <cmath>
+#include <sstream>
+
+using namespace vnix::units;
+
+
+TEST_CASE("Uncertain number propagates to first order.", "[uncertain]") {
+  using U = uncertain<double>;
+  U const a(3, 0.3), b(4, 0.4);
+
+  U const s = a + b;
+  REQUIRE(s.v == 7);
+  REQUIRE(s.s == Approx(0.5));
+  REQUIRE((a - b).v == -1);
+  REQUIRE((a - b).s == Approx(0.5));
+
+  // Relative uncertainties add in quadrature for product and quotient.
+  U const p = a * b;
+  REQUIRE(p.v == 12);
+  REQUIRE(p.s / p.v == Approx(std::sqrt(0.01 + 0.01)));
+  U const q = a / b;
+  REQUIRE(q.v == Approx(0.75));
+  REQUIRE(q.s / q.v == Approx(std::sqrt(0.01 + 0.01)));
+
+  REQUIRE((a * -2.0).s == Approx(0.6));
+  REQUIRE((a * -2.0).v == -6);
+  REQUIRE(pow(a, 2.0).s == Approx(2 * 3 * 0.3));
+  REQUIRE(sqrt(b).v == 2);
+  REQUIRE(sqrt(b).s == Approx(0.1));
+
+  std::ostringstream oss;
+  oss << a;
+  REQUIRE(oss.str() == "(3 +/- 0.3)");
+}
+
+
+TEST_CASE("Uncertainty has dimension of quantity.", "[uncertain]") {
+  using namespace dbl;
+  auto const d = with_sigma(100.0 * m, 1.0 * m);
+  auto const t = with_sigma(20.0 * s, 0.2 * s);
+  auto const v = d / t;
+  REQUIRE(estimate(v) == 5.0 * m / s);
+  REQUIRE((sigma(v) / (m / s)).to_number() == Approx(0.05 * std::sqrt(2.0)));
+  speed const sv = sigma(v);
+  REQUIRE(sv.raw_number() == Approx(5.0 * std::sqrt(2.0) * 0.01));
+
+  // Factors are taken to be uncorrelated, even when they are the same, but
+  // pow() is exact to first order.
+  auto const a = d * d;
+  area const ea = estimate(a);
+  REQUIRE(ea == 1.0E+04 * m * m);
+  auto const r = a.square_root();
+  REQUIRE(estimate(r) == 100.0 * m);
+  REQUIRE((sigma(r) / m).to_number() == Approx(std::sqrt(0.5)));
+  auto const c = pow<3>(d);
+  REQUIRE((sigma(c) / (m * m * m)).to_number() == Approx(3.0E+04));
+
+  // Sum with exact quantity.
+  auto const e = d + 5.0 * m;
+  REQUIRE(estimate(e) == 105.0 * m);
+  REQUIRE(sigma(e) == 1.0 * m);
+
+  dyndim const sd = 2.0 * s;
+  REQUIRE_THROWS(with_sigma(dyndim(100.0 * m), sd));
+}
+
+
+TEST_CASE("Uncertain batch propagates over arrays.", "[uncertain]") {
+  using namespace dbl;
+  size_t const                  n = 1000;
+  basic_uncertain_batch<double> x(n, length_dim), t(n, time_dim);
+  for (size_t i = 0; i < n; ++i) {
+    x.set(i, with_sigma(double(i + 1) * m, 0.1 * m));
+    t.set(i, with_sigma(2.0 * s, 0.02 * s));
+  }
+  REQUIRE_THROWS(x.set(0, with_sigma(2.0 * s, 0.02 * s)));
+
+  auto const v = x / t;
+  REQUIRE(v.d() == speed::d());
+  REQUIRE(v.size() == n);
+  for (size_t i = 0; i < n; i += 97) {
+    auto const e = x[i] / t[i];
+    REQUIRE(v.estimates()[i] == Approx(estimate(e).raw_number()));
+    REQUIRE(v.sigmas()[i] == Approx(sigma(e).raw_number()));
+  }
+
+  auto const s2 = x + x;
+  REQUIRE(s2.sigmas()[5] == Approx(0.1 * std::sqrt(2.0)));
+  REQUIRE((x - x).estimates()[5] == 0);
+  auto const p = x * t;
+  REQUIRE(p.d() == length_dim + time_dim);
+  auto const r = sqrt(x * x);
+  REQUIRE(r.d() == length_dim);
+  REQUIRE(r.estimates()[9] == Approx(10));
+  REQUIRE(r.sigmas()[9] == Approx(0.1 * std::sqrt(0.5)));
+  auto const c = pow(x, dim::rat(3));
+  REQUIRE(c.sigmas()[9] == Approx(3 * 100 * 0.1));
+
+  auto y = x;
+  y /= t;
+  REQUIRE(y.d() == speed::d());
+  REQUIRE(y.sigmas()[7] == v.sigmas()[7]);
+  y *= t;
+  REQUIRE(y.d() == length_dim);
+  REQUIRE(y.estimates()[7] == Approx(8));
+
+  REQUIRE_THROWS(x + t);
+  REQUIRE_THROWS(x / basic_uncertain_batch<double>(3, time_dim));
+}
@@ -0,0 +1,39 @@
+/// @file       test/unit-expr-test.cpp
+/// @brief      Test-cases for vnix::units::parse_unit.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+
+#include "../vnix/units/unit-expr.hpp"
+#include "catch.hpp"
+
+using namespace vnix::units;
+
+
+TEST_CASE("Single symbols are found in unit_syms.", "[unit-expr]") {
+  REQUIRE(parse_unit("m").sf == 1);
+  REQUIRE(parse_unit("m").d == length_dim);
+  REQUIRE(parse_unit("km").sf == Approx(1000));
+  REQUIRE(parse_unit("mN").sf == Approx(1));
+  REQUIRE(parse_unit("mN").d == dbl::force::d());
+  REQUIRE(parse_unit("ft").sf == Approx(0.3048));
+  REQUIRE(parse_unit("").d == nul_dim);
+  REQUIRE_THROWS(parse_unit("furlong"));
+}
+
+
+TEST_CASE("Expressions of units are parsed.", "[unit-expr]") {
+  REQUIRE(parse_unit("m/s").d == dbl::speed::d());
+  REQUIRE(parse_unit("m/s^2").d == dbl::acceleration::d());
+  REQUIRE(parse_unit("m s^-2").d == dbl::acceleration::d());
+  REQUIRE(parse_unit("kg*m/s/s").sf == Approx(1000));
+  REQUIRE(parse_unit("kg*m/s/s").d == dbl::force::d());
+  REQUIRE(parse_unit("ft/12").sf == Approx(0.0254));
+  REQUIRE(parse_unit("1/(ms)").sf == Approx(1000));
+  REQUIRE(parse_unit("1/(ms)").d == nul_dim - time_dim);
+  REQUIRE(parse_unit("m^[1/2]").d == length_dim / dim::rat(2));
+  REQUIRE(parse_unit("km^[1/2]").sf == Approx(std::sqrt(1000.0)));
+  REQUIRE_THROWS(parse_unit("m)"));
+  REQUIRE_THROWS(parse_unit("(m"));
+  REQUIRE_THROWS(parse_unit("m^"));
+  REQUIRE_THROWS(parse_unit("m,s"));
+}
@@ -0,0 +1,91 @@
+/// @file       test/zero-overhead.cpp
+/// @brief      Pairs of kernels, raw_<name> on bare numbers and dim_<name> on
+///             quantities, whose machine-code is compared by
+///             check-zero-overhead.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD three-clause; see LICENSE.
+///
+/// This file is compiled with optimization but is not linked.  For each pair,
+/// the number of instructions in dim_<name> must not exceed that in
+/// raw_<name>.
+
+#include "../vnix/units.hpp"
+#include <cmath>
+
+#ifdef ZERO_OVERHEAD_EIGEN
+#include <eigen3/Eigen/Core>
+#endif
+
+using namespace vnix::units;
+using namespace vnix::units::dbl;
+
+
+// Arithmetic on scalar quantities.
+
+double raw_add(double a, double b) { return a + b; }
+length dim_add(length a, length b) { return a + b; }
+
+double raw_scale(double a, double k) { return a * k; }
+length dim_scale(length a, double k) { return a * k; }
+
+double raw_mul(double f, double d) { return f * d; }
+energy dim_mul(force f, length d) { return f * d; }
+
+double raw_div(double d, double t) { return d / t; }
+speed  dim_div(length d, dbl::time t) { return d / t; }
+
+bool raw_less(double a, double b) { return a < b; }
+bool dim_less(length a, length b) { return a < b; }
+
+double raw_sqrt(double a) { return std::sqrt(a); }
+length dim_sqrt(area a) { return sqrt(a); }
+
+double raw_square(double a) { return std::pow(a, 2.0); }
+area   dim_square(length a) { return pow<2>(a); }
+
+float       raw_add_flt(float a, float b) { return a + b; }
+flt::length dim_add_flt(flt::length a, flt::length b) { return a + b; }
+
+
+// Literals and generated constructors of units.
+
+double raw_literal(double d) { return d / 2.5; }
+speed  dim_literal(length d) { return d / 2.5_s; }
+
+double raw_ctor_km(double x) { return x * 1000.0; }
+length dim_ctor_km(double x) { return kilometers(x); }
+
+double raw_ctor_ft(double x) { return x * 0.3048; }
+length dim_ctor_ft(double x) { return feet(x); }
+
+double raw_ctor_kJ(double x) { return x * 1000.0; }
+energy dim_ctor_kJ(double x) { return kilojoules(x); }
+
+float       raw_ctor_km_flt(float x) { return x * 1000.0f; }
+flt::length dim_ctor_km_flt(float x) { return kilometers(x); }
+
+
+#ifdef ZERO_OVERHEAD_EIGEN
+
+// Quantities whose numeric type is a vector of Eigen.
+
+using vec    = Eigen::Vector3d;
+using lenvec = basic_statdim<length_dim.encode(), vec>;
+using spdvec = basic_statdim<(length_dim - time_dim).encode(), vec>;
+
+// Each kernel returns an evaluated vector, not an expression of Eigen, so that
+// both kernels in a pair compute the sum or quotient.
+
+vec    raw_vadd(vec const &a, vec const &b) { return a + b; }
+lenvec dim_vadd(lenvec const &a, lenvec const &b) { return a + b; }
+
+vec    raw_vdiv(vec const &d, double t) { return d / t; }
+spdvec dim_vdiv(lenvec const &d, dbl::time t) { return d / t; }
+
+double raw_vdot(vec const &a, vec const &b) { return a.dot(b); }
+auto   dim_vdot(lenvec const &a, lenvec const &b) { return a.dot(b); }
+
+vec    raw_vctor(vec const &x) { return x * 1000.0; }
+lenvec dim_vctor(vec const &x) { return kilometers(x); }
+
+#endif
@@ -6,6 +6,8 @@
 #ifndef VNIX_BIT_HPP
 #define VNIX_BIT_HPP
 
+#include <climits> // for CHAR_BIT
+
 namespace vnix {
 
 
@@ -16,13 +18,20 @@ template <typename I> constexpr I bit(unsigned n) { return I(1) << n; }
 
 
 /// Word with specified range of bits set.
-/// @tparam I   Type of integer word.
+///
+/// The mask is computed in closed form, by shifting a word of all ones from
+/// each end, rather than by setting one bit at a time, so that evaluation at
+/// compile-time does not recurse.
+///
+/// @tparam I   Type of unsigned integer word.
 /// @param  n1  Offset of bit at one   end of range.
 /// @param  n2  Offset of bit at other end of range.
 template <typename I> constexpr I bit_range(unsigned n1, unsigned n2) {
-  if (n1 < n2) { return bit<I>(n1) | bit_range<I>(n1 + 1, n2); }
-  if (n2 < n1) { return bit<I>(n2) | bit_range<I>(n2 + 1, n1); }
-  return bit<I>(n1);
+  unsigned const lo   = (n1 < n2 ? n1 : n2);
+  unsigned const hi   = (n1 < n2 ? n2 : n1);
+  unsigned const top  = sizeof(I) * CHAR_BIT - 1; // Offset of highest bit.
+  I const        ones = I(~I(0));
+  return I(I(ones >> (top - hi)) & I(ones << lo));
 }
 
 
@@ -0,0 +1,129 @@
+/// @file       vnix/error.hpp
+/// @brief      Definition of vnix::error and of the hook for handling an error
+///             when exceptions are disabled.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD Three-Clause; see LICENSE.
+
+#ifndef VNIX_ERROR_HPP
+#define VNIX_ERROR_HPP
+
+#include <cstdio>  // for fputs
+#include <cstdlib> // for abort
+
+// VNIX_EXCEPTIONS is 1 if the library should throw on error and 0 if it should
+// instead call the handler installed by vnix::set_error_handler().  By
+// default, it is 0 only if the compiler disable exceptions, as by
+// -fno-exceptions.  Define it as 0 in order to use the handler anyway.
+#ifndef VNIX_EXCEPTIONS
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#define VNIX_EXCEPTIONS 1
+#else
+#define VNIX_EXCEPTIONS 0
+#endif
+#endif
+
+// Without exceptions, no function in the library throws, and so an operation
+// that can fail only on error is marked noexcept.  If VNIX_EXCEPTIONS be 0
+// while exceptions are enabled, then an exception thrown by the numeric type
+// of a quantity terminates the program.
+#if VNIX_EXCEPTIONS
+#define VNIX_NOEXCEPT
+#else
+#define VNIX_NOEXCEPT noexcept
+#endif
+
+namespace vnix {
+
+
+/// Type of function called, without exceptions, on each error.
+using error_handler = void (*)(char const *msg);
+
+
+/// Default handler, which prints the message and aborts.
+/// @param msg  Message describing error.
+inline void abort_on_error(char const *msg) {
+  std::fputs(msg, stderr);
+  std::fputs("\n", stderr);
+  std::abort();
+}
+
+
+/// Handler that does nothing, so that each error is reported only by
+/// last_error(), as by a code of error.
+inline void record_error(char const *) {}
+
+
+namespace impl {
+
+/// Handler called, without exceptions, on each error.
+inline error_handler &handler() {
+  static error_handler h = abort_on_error;
+  return h;
+}
+
+/// Message of most recent error in calling thread.
+inline char const *&last_error() {
+  static thread_local char const *m = nullptr;
+  return m;
+}
+
+} // namespace impl
+
+
+/// Install handler called, without exceptions, on each error.
+///
+/// If the handler return, then the function that detected the error returns
+/// an unspecified value.  Arithmetic on rationals, dimensions, and quantities
+/// continues safely after that, but a function that reads, indexes, or
+/// schedules work, such as a parser or a pipeline, should be used only with a
+/// handler that does not return.
+///
+/// @param h  Pointer to new handler.
+/// @return   Pointer to previous handler.
+inline error_handler set_error_handler(error_handler h) {
+  error_handler const p = impl::handler();
+  impl::handler()       = h;
+  return p;
+}
+
+
+/// Message of most recent error in calling thread, or null if there were no
+/// error since the last call to clear_error().  This is set only without
+/// exceptions.
+inline char const *last_error() { return impl::last_error(); }
+
+
+/// Forget most recent error in calling thread.
+inline void clear_error() { impl::last_error() = nullptr; }
+
+
+#if VNIX_EXCEPTIONS
+
+/// Report error by throwing the message.
+///
+/// Because error() is not constexpr, a call to it during evaluation of a
+/// constant expression is diagnosed at compile-time, as a throw would be.
+///
+/// @param msg  Message describing error.
+[[noreturn]] inline void error(char const *msg) { throw msg; }
+
+#else
+
+/// Report error by recording the message for last_error() and then calling
+/// the handler.
+///
+/// Because error() is not constexpr, a call to it during evaluation of a
+/// constant expression is diagnosed at compile-time.
+///
+/// @param msg  Message describing error.
+inline void error(char const *msg) noexcept {
+  impl::last_error() = msg;
+  impl::handler()(msg);
+}
+
+#endif
+
+
+} // namespace vnix
+
+#endif // ndef VNIX_ERROR_HPP
@@ -6,6 +6,8 @@
 #ifndef VNIX_GCD_HPP
 #define VNIX_GCD_HPP
 
+#include <vnix/int-types.hpp> // for int_types
+
 /// Thomas E. Vaughan's public software.
 namespace vnix {
 
@@ -19,14 +21,63 @@ template <typename U, typename V> using gcd_promoted = decltype(U() % V());
 namespace impl {
 
 
-/// Greatest common divisor of two nonnegative numbers.
-/// @param a  First  nonnegative number.
-/// @param b  Second nonnegative number.
-/// @return   Greatest common divisor.
-template <typename A, typename B>
-constexpr gcd_promoted<A, B> basic_gcd(A a, B b) {
-  if (b == 0) { return a; }
-  return basic_gcd(b, a % b);
+/// Number of trailing zero-bits in a nonzero unsigned number.
+/// @tparam U  Unsigned type of number, not wider than 64 bits.
+/// @param  u  Nonzero number.
+/// @return    Number of trailing zero-bits.
+template <typename U> constexpr int ctz(U u) {
+#ifdef __GNUC__
+  return __builtin_ctzll(u);
+#else
+  int n = 0;
+  while ((u & 1) == 0) {
+    u >>= 1;
+    ++n;
+  }
+  return n;
+#endif
+}
+
+#ifdef __SIZEOF_INT128__
+/// Number of trailing zero-bits in a nonzero 128-bit number.
+/// @param u  Nonzero number.
+/// @return   Number of trailing zero-bits.
+constexpr int ctz(int_types<128>::UF u) {
+  using ull    = unsigned long long;
+  ull const lo = ull(u);
+  return lo ? __builtin_ctzll(lo) : 64 + __builtin_ctzll(ull(u >> 64));
+}
+#endif
+
+
+/// Greatest common divisor of two unsigned numbers by Stein's binary
+/// algorithm.
+///
+/// Each step is a subtraction and a shift by the count of trailing zeros, in
+/// place of the division in each step of Euclid's algorithm.  Both u and v
+/// are odd at the top of the loop.  Because the difference and its negative
+/// have the same count of trailing zeros, the count is computed from the
+/// wrapped difference alongside the choice of minimum and of absolute
+/// difference, which the compiler makes without a branch.
+///
+/// @tparam U  Unsigned type of numbers.
+/// @param  u  First  number.
+/// @param  v  Second number.
+/// @return    Greatest common divisor.
+template <typename U> constexpr U binary_gcd(U u, U v) {
+  if (u == 0) { return v; }
+  if (v == 0) { return u; }
+  int const shift = ctz(U(u | v)); // Power of two common to u and v.
+  u >>= ctz(u);
+  v >>= ctz(v);
+  while (u != v) {
+    U const    d  = v - u;
+    int const  z  = ctz(d);
+    bool const lt = (u < v);
+    u             = (lt ? u : v);
+    v             = U(lt ? d : U(U(0) - d)) >> z;
+  }
+  return u << shift;
 }
 
 
@@ -38,10 +89,12 @@ constexpr gcd_promoted<A, B> basic_gcd(A a, B b) {
 /// @param b  Second number.
 /// @return   Greatest common divisor.
 template <typename A, typename B> constexpr gcd_promoted<A, B> gcd(A a, B b) {
-  if (a < 0) { a = -a; }
-  if (b == 0) { return a; }
-  if (b < 0) { b = -b; }
-  return impl::basic_gcd(b, a % b);
+  using P = gcd_promoted<A, B>;
+  using U = typename int_types<8 * sizeof(P)>::UF;
+  // The magnitude of the most negative number is representable in U.
+  U const x = (a < 0 ? U(0) - U(a) : U(a));
+  U const y = (b < 0 ? U(0) - U(b) : U(b));
+  return P(impl::binary_gcd(x, y));
 }
 
 
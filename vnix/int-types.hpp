@@ -15,11 +15,12 @@ namespace vnix {
 ///
 /// Generic int_types refers to the int_types with the next-larger number of
 /// bits.  The recursion ends with a terminal specialization: int_types<8>,
-/// int_types<16>, int_types<32>, or int_types<64>.
+/// int_types<16>, int_types<32>, int_types<64>, or, where the compiler
+/// provides a 128-bit integer, int_types<128>.
 ///
 /// @tparam NB  Number of bits.
 template <unsigned NB> struct int_types {
-  static_assert(NB <= 64, "Word must not require more than 64 bits.");
+  static_assert(NB <= 128, "Word must not require more than 128 bits.");
   using US = typename int_types<NB + 1>::US; ///< Smallest unsigned integer.
   using SS = typename int_types<NB + 1>::SS; ///< Smallest   signed integer.
   using UF = typename int_types<NB + 1>::UF; ///< Fastest unsigned integer.
@@ -58,6 +59,16 @@ template <> struct int_types<64> {
   using SF = int_fast64_t;   ///< Fastest   signed integer.
 };
 
+#ifdef __SIZEOF_INT128__
+/// Terminal specialization of int_types for 128-bit integer.
+template <> struct int_types<128> {
+  __extension__ typedef unsigned __int128 US; ///< Smallest unsigned integer.
+  __extension__ typedef __int128 SS;          ///< Smallest   signed integer.
+  using UF = US;                              ///< Fastest unsigned integer.
+  using SF = SS;                              ///< Fastest   signed integer.
+};
+#endif
+
 
 } // namespace vnix
 
@@ -0,0 +1,522 @@
+/// @file       vnix/mv/mat.hpp
+/// @brief      Definition of vnix::mv::mat, vnix::mv::mref, and operations.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD Three-Clause; see LICENSE.
+
+#ifndef VNIX_MV_MAT_HPP
+#define VNIX_MV_MAT_HPP
+
+#include <array>            // for array
+#include <cstddef>          // for size_t
+#include <initializer_list> // for initializer_list
+#include <ostream>          // for ostream, endl
+#include <type_traits>      // for remove_const_t, integral_constant
+#include <utility>          // for index_sequence, declval
+
+namespace vnix {
+namespace mv {
+
+
+namespace impl {
+
+
+/// Convert element i of array a from type OT to type T.
+template <typename T, typename OT, size_t N>
+constexpr T cnv_el(std::array<OT, N> const &a, size_t i) {
+  return a[i];
+}
+
+/// Convert array of elements of type OT to array of elements of type T.
+template <typename T, typename OT, size_t... i>
+constexpr auto cnv(std::array<OT, sizeof...(i)> const &a,
+                   std::index_sequence<i...>) {
+  return std::array<T, sizeof...(i)>{{cnv_el<T>(a, i)...}};
+}
+
+/// Convert array of elements of type OT to array of elements of type T.
+template <typename T, typename OT, size_t N>
+constexpr auto cnv_ar(std::array<OT, N> const &a) {
+  return cnv<T>(a, std::make_index_sequence<N>{});
+}
+
+
+} // namespace impl
+
+
+/// Reference to column or row in matrix.
+/// @tparam T  Type of element.
+/// @tparam S  Distance in memory between successive elements.
+/// @tparam N  Number of elements.
+template <typename T, size_t S, size_t N> class mref {
+  T *beg_; ///< Pointer to first element.
+
+public:
+  constexpr mref(T *b) : beg_(b) {}                ///< Initialize aggregate.
+  constexpr static size_t size() { return N; }     ///< Number of elements.
+  constexpr T *           begin() { return beg_; } ///< First element.
+
+  /// Pointer to element that is S elements past last element identified by
+  /// mref.
+  constexpr T *end() { return beg_ + S * N; }
+
+  /// Assign from list.
+  constexpr mref &operator=(std::initializer_list<T> list) {
+    auto i  = list.begin();
+    auto j  = begin();
+    auto ie = list.end();
+    auto je = end();
+    while (i != ie && j != je) {
+      *j = *i++;
+      j += S;
+    }
+    return *this;
+  }
+
+  /// Distance in memory between successive elements.
+  constexpr static size_t stride() { return S; }
+
+  /// Access element at offset off.
+  constexpr T &operator()(size_t off) const { return beg_[S * off]; }
+};
+
+/// Dot-product of two mrefs.
+template <typename T1, typename T2, size_t S1, size_t S2, size_t N>
+constexpr auto dot(mref<T1, S1, N> const &mr1, mref<T2, S2, N> const &mr2) {
+  auto sum = 0 * mr1(0) * mr2(0);
+  for (size_t i = 0; i < N; ++i) { sum += mr1(i) * mr2(i); }
+  return sum;
+}
+
+
+/// Model of a fixed-size matrix of numbers or of quantities, such as
+/// vnix::units::flt::force.
+///
+/// Elements are stored contiguously in row-major order, with the alignment
+/// of an element.  Because every size is known at compile-time, each loop has
+/// a fixed trip-count and is unrolled or vectorized by the compiler, with
+/// unaligned loads.  The matrix is not over-aligned, because, in C++14,
+/// neither operator new nor std::allocator would honor that.  A matrix of
+/// numbers can itself be the numeric part of a vnix::units::dimval.
+///
+/// @tparam T   Type of element.
+/// @tparam NR  Number of rows.
+/// @tparam NC  Number of columns.
+template <typename T, size_t NR, size_t NC> struct mat {
+  /// Array in which elements are stored.
+  std::array<T, NR * NC> a;
+
+  /// Allow access to every other type of matrix.
+  template <typename OT, size_t ONR, size_t ONC> friend struct mat;
+
+  mat() {} ///< By default, do not initialize.
+
+  /// Initialize from list.
+  template <typename... X> constexpr mat(X... xs) : a({T(xs)...}) {}
+
+  /// Copy from same-size matrix of other element-type OT.
+  template <typename OT>
+  constexpr mat(mat<OT, NR, NC> const &m) : a(impl::cnv_ar<T>(m.a)) {}
+
+  constexpr static size_t rows() { return NR; } ///< Number of rows.
+  constexpr static size_t cols() { return NC; } ///< Number of columns.
+
+  /// Immutable element.
+  /// @param i  Offset of row.
+  /// @param j  Offset of column.
+  constexpr T const &operator()(size_t i, size_t j) const {
+    return a[NC * i + j];
+  }
+
+  /// Mutable element.
+  /// @param i  Offset of row.
+  /// @param j  Offset of column.
+  constexpr T &operator()(size_t i, size_t j) { return a[NC * i + j]; }
+
+  /// Reference to immutable column.
+  constexpr auto col(size_t off) const {
+    return mref<T const, NC, NR>(a.data() + off);
+  }
+
+  /// Reference to mutable column.
+  constexpr auto col(size_t off) {
+    using RT = typename std::remove_const<T>::type;
+    return mref<RT, NC, NR>(a.data() + off);
+  }
+
+  /// Reference to immutable row.
+  constexpr auto row(size_t off) const {
+    return mref<T const, 1, NC>(a.data() + NC * off);
+  }
+
+  /// Reference to mutable row.
+  constexpr auto row(size_t off) {
+    using RT = typename std::remove_const<T>::type;
+    return mref<RT, 1, NC>(a.data() + NC * off);
+  }
+};
+
+/// Model of column of quantities.
+template <typename T, size_t NR> using col = mat<T, NR, 1>;
+
+/// Model of row of quantities.
+template <typename T, size_t NC> using row = mat<T, 1, NC>;
+
+
+/// Compare two matrices element by element.
+template <typename T1, typename T2, size_t NR, size_t NC>
+constexpr bool operator==(mat<T1, NR, NC> const &m1,
+                          mat<T2, NR, NC> const &m2) {
+  for (size_t i = 0; i < NR * NC; ++i) {
+    if (!(m1.a[i] == m2.a[i])) { return false; }
+  }
+  return true;
+}
+
+/// Compare two matrices element by element.
+template <typename T1, typename T2, size_t NR, size_t NC>
+constexpr bool operator!=(mat<T1, NR, NC> const &m1,
+                          mat<T2, NR, NC> const &m2) {
+  return !(m1 == m2);
+}
+
+/// Add two matrices.
+template <typename T1, typename T2, size_t NR, size_t NC>
+constexpr auto operator+(mat<T1, NR, NC> const &m1,
+                         mat<T2, NR, NC> const &m2) {
+  using TS = std::remove_const_t<decltype(m1.a[0] + m2.a[0])>;
+  mat<TS, NR, NC> s; // sum
+  for (size_t i = 0; i < NR * NC; ++i) { s.a[i] = m1.a[i] + m2.a[i]; }
+  return s;
+}
+
+/// Subtract two matrices.
+template <typename T1, typename T2, size_t NR, size_t NC>
+constexpr auto operator-(mat<T1, NR, NC> const &m1,
+                         mat<T2, NR, NC> const &m2) {
+  using TD = std::remove_const_t<decltype(m1.a[0] - m2.a[0])>;
+  mat<TD, NR, NC> d; // difference
+  for (size_t i = 0; i < NR * NC; ++i) { d.a[i] = m1.a[i] - m2.a[i]; }
+  return d;
+}
+
+/// Multiply two matrices.
+///
+/// Each row of the product accumulates scaled rows of the right-hand factor,
+/// so that the innermost loop runs over contiguous elements with a fixed
+/// trip-count.
+template <typename T1, typename T2, size_t NR1, size_t NC2, size_t N>
+constexpr auto operator*(mat<T1, NR1, N> const &m1,
+                         mat<T2, N, NC2> const &m2) {
+  using TP = std::remove_const_t<decltype(m1.a[0] * m2.a[0])>;
+  mat<TP, NR1, NC2> pr; // product
+  for (size_t i = 0; i < NR1; ++i) {
+    TP acc[NC2]; // Local, so that compiler need not check for aliasing.
+    for (size_t j = 0; j < NC2; ++j) { acc[j] = m1(i, 0) * m2.a[j]; }
+    for (size_t k = 1; k < N; ++k) {
+      T1 const aik = m1(i, k);
+      for (size_t j = 0; j < NC2; ++j) { acc[j] = acc[j] + aik * m2(k, j); }
+    }
+    for (size_t j = 0; j < NC2; ++j) { pr(i, j) = acc[j]; }
+  }
+  return pr;
+}
+
+/// Multiply matrix on left by scalar.
+template <typename T1, typename T2, size_t NR2, size_t NC2>
+constexpr auto operator*(T1 const &s1, mat<T2, NR2, NC2> const &m2) {
+  using TP = std::remove_const_t<decltype(s1 * m2.a[0])>;
+  mat<TP, NR2, NC2> pr; // product
+  for (size_t i = 0; i < NR2 * NC2; ++i) { pr.a[i] = s1 * m2.a[i]; }
+  return pr;
+}
+
+/// Multiply matrix on right by scalar.
+template <typename T1, typename T2, size_t NR1, size_t NC1>
+constexpr auto operator*(mat<T1, NR1, NC1> const &m1, T2 const &s2) {
+  using TP = std::remove_const_t<decltype(m1.a[0] * s2)>;
+  mat<TP, NR1, NC1> pr; // product
+  for (size_t i = 0; i < NR1 * NC1; ++i) { pr.a[i] = m1.a[i] * s2; }
+  return pr;
+}
+
+/// Transpose of matrix.
+template <typename T, size_t NR, size_t NC>
+constexpr auto transpose(mat<T, NR, NC> const &m) {
+  mat<std::remove_const_t<T>, NC, NR> t; // transpose
+  for (size_t i = 0; i < NR; ++i) {
+    for (size_t j = 0; j < NC; ++j) { t(j, i) = m(i, j); }
+  }
+  return t;
+}
+
+
+namespace impl {
+
+
+/// Type of element of inverse of matrix whose element is of type T.
+template <typename T>
+using inv_t = std::remove_const_t<decltype(1 / std::declval<T>())>;
+
+/// Type of dimensionless ratio of two elements of type T.
+template <typename T>
+using ratio_t =
+    std::remove_const_t<decltype(std::declval<T>() / std::declval<T>())>;
+
+
+/// Product of first K diagonal elements of matrix.
+template <typename T, size_t N>
+constexpr auto diag_prod(mat<T, N, N> const &m,
+                         std::integral_constant<size_t, 1>) {
+  return m(0, 0);
+}
+
+/// Product of first K diagonal elements of matrix.
+template <typename T, size_t N, size_t K>
+constexpr auto diag_prod(mat<T, N, N> const &m,
+                         std::integral_constant<size_t, K>) {
+  auto const p = diag_prod(m, std::integral_constant<size_t, K - 1>());
+  return p * m(K - 1, K - 1);
+}
+
+
+/// LU-decomposition, with partial pivoting, of square matrix whose elements
+/// share a type, which may be a quantity.  The multipliers in L are
+/// dimensionless, and U has the type of the original element.
+template <typename T, size_t N> struct lu {
+  using R = ratio_t<T>; ///< Type of multiplier.
+
+  mat<std::remove_const_t<T>, N, N> u; ///< Upper-triangular factor.
+  mat<R, N, N> l;    ///< Lower-triangular factor, with unit diagonal implied.
+  size_t       p[N]; ///< Original offset of each row.
+  int          sign; ///< Sign of permutation.
+
+  /// Decompose matrix.
+  /// @param m  Matrix.
+  constexpr lu(mat<T, N, N> const &m) : u(m), l(), p(), sign(1) {
+    for (size_t i = 0; i < N; ++i) { p[i] = i; }
+    for (size_t k = 0; k < N; ++k) {
+      size_t r = k;
+      for (size_t i = k + 1; i < N; ++i) {
+        if (u(r, k) * u(r, k) < u(i, k) * u(i, k)) { r = i; }
+      }
+      if (r != k) {
+        for (size_t j = 0; j < N; ++j) {
+          auto const t = u(k, j);
+          u(k, j)      = u(r, j);
+          u(r, j)      = t;
+        }
+        for (size_t j = 0; j < k; ++j) {
+          R const t = l(k, j);
+          l(k, j)   = l(r, j);
+          l(r, j)   = t;
+        }
+        size_t const t = p[k];
+        p[k]           = p[r];
+        p[r]           = t;
+        sign           = -sign;
+      }
+      for (size_t i = k + 1; i < N; ++i) {
+        R const f = u(i, k) / u(k, k);
+        l(i, k)   = f;
+        for (size_t j = k; j < N; ++j) { u(i, j) = u(i, j) - f * u(k, j); }
+      }
+    }
+  }
+
+  /// Determinant of original matrix.
+  constexpr auto det() const {
+    return sign * diag_prod(u, std::integral_constant<size_t, N>());
+  }
+
+  /// Inverse of original matrix.
+  ///
+  /// Forward- and back-substitution operate on whole rows, so that each
+  /// innermost loop runs over contiguous elements with a fixed trip-count.
+  constexpr auto inverse() const {
+    mat<R, N, N> y; // L^-1 P
+    for (size_t i = 0; i < N; ++i) {
+      for (size_t j = 0; j < N; ++j) { y(i, j) = R(p[i] == j ? 1 : 0); }
+      for (size_t k = 0; k < i; ++k) {
+        R const f = l(i, k);
+        for (size_t j = 0; j < N; ++j) { y(i, j) = y(i, j) - f * y(k, j); }
+      }
+    }
+    mat<inv_t<T>, N, N> x; // U^-1 L^-1 P
+    for (size_t i = N; i-- > 0;) {
+      for (size_t k = i + 1; k < N; ++k) {
+        auto const f = u(i, k);
+        for (size_t j = 0; j < N; ++j) { y(i, j) = y(i, j) - f * x(k, j); }
+      }
+      auto const d = 1 / u(i, i);
+      for (size_t j = 0; j < N; ++j) { x(i, j) = y(i, j) * d; }
+    }
+    return x;
+  }
+};
+
+
+/// Determinant of 2x2 matrix.
+template <typename T>
+constexpr auto det(mat<T, 2, 2> const &m, std::integral_constant<size_t, 2>) {
+  return m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0);
+}
+
+/// Determinant of 3x3 matrix, by cofactors.
+template <typename T>
+constexpr auto det(mat<T, 3, 3> const &m, std::integral_constant<size_t, 3>) {
+  return m(0, 0) * (m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1)) +
+         m(0, 1) * (m(1, 2) * m(2, 0) - m(1, 0) * m(2, 2)) +
+         m(0, 2) * (m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0));
+}
+
+/// Minors of 4x4 matrix: s from the upper two rows, and c from the lower two.
+template <typename T> struct minors4 {
+  using M = std::remove_const_t<decltype(std::declval<T>() *
+                                         std::declval<T>())>; ///< Type.
+  M s0, s1, s2, s3, s4, s5; ///< 2x2 minors of upper rows.
+  M c0, c1, c2, c3, c4, c5; ///< 2x2 minors of lower rows.
+
+  /// Compute minors.
+  constexpr minors4(mat<T, 4, 4> const &m)
+      : s0(m(0, 0) * m(1, 1) - m(1, 0) * m(0, 1)),
+        s1(m(0, 0) * m(1, 2) - m(1, 0) * m(0, 2)),
+        s2(m(0, 0) * m(1, 3) - m(1, 0) * m(0, 3)),
+        s3(m(0, 1) * m(1, 2) - m(1, 1) * m(0, 2)),
+        s4(m(0, 1) * m(1, 3) - m(1, 1) * m(0, 3)),
+        s5(m(0, 2) * m(1, 3) - m(1, 2) * m(0, 3)),
+        c0(m(2, 0) * m(3, 1) - m(3, 0) * m(2, 1)),
+        c1(m(2, 0) * m(3, 2) - m(3, 0) * m(2, 2)),
+        c2(m(2, 0) * m(3, 3) - m(3, 0) * m(2, 3)),
+        c3(m(2, 1) * m(3, 2) - m(3, 1) * m(2, 2)),
+        c4(m(2, 1) * m(3, 3) - m(3, 1) * m(2, 3)),
+        c5(m(2, 2) * m(3, 3) - m(3, 2) * m(2, 3)) {}
+
+  /// Determinant.
+  constexpr auto det() const {
+    return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+  }
+};
+
+/// Determinant of 4x4 matrix, by 2x2 minors.
+template <typename T>
+constexpr auto det(mat<T, 4, 4> const &m, std::integral_constant<size_t, 4>) {
+  return minors4<T>(m).det();
+}
+
+/// Determinant of larger matrix, by LU-decomposition.
+template <typename T, size_t N, size_t K>
+constexpr auto det(mat<T, N, N> const &m, std::integral_constant<size_t, K>) {
+  return lu<T, N>(m).det();
+}
+
+
+/// Inverse of 2x2 matrix.
+template <typename T>
+constexpr auto inverse(mat<T, 2, 2> const &m,
+                       std::integral_constant<size_t, 2>) {
+  auto const          id = 1 / det(m, std::integral_constant<size_t, 2>());
+  mat<inv_t<T>, 2, 2> x;
+  x(0, 0) = m(1, 1) * id;
+  x(0, 1) = (0 * m(0, 1) - m(0, 1)) * id;
+  x(1, 0) = (0 * m(1, 0) - m(1, 0)) * id;
+  x(1, 1) = m(0, 0) * id;
+  return x;
+}
+
+/// Inverse of 3x3 matrix, by adjugate.
+template <typename T>
+constexpr auto inverse(mat<T, 3, 3> const &m,
+                       std::integral_constant<size_t, 3>) {
+  auto const          id = 1 / det(m, std::integral_constant<size_t, 3>());
+  mat<inv_t<T>, 3, 3> x;
+  x(0, 0) = (m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1)) * id;
+  x(0, 1) = (m(0, 2) * m(2, 1) - m(0, 1) * m(2, 2)) * id;
+  x(0, 2) = (m(0, 1) * m(1, 2) - m(0, 2) * m(1, 1)) * id;
+  x(1, 0) = (m(1, 2) * m(2, 0) - m(1, 0) * m(2, 2)) * id;
+  x(1, 1) = (m(0, 0) * m(2, 2) - m(0, 2) * m(2, 0)) * id;
+  x(1, 2) = (m(0, 2) * m(1, 0) - m(0, 0) * m(1, 2)) * id;
+  x(2, 0) = (m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0)) * id;
+  x(2, 1) = (m(0, 1) * m(2, 0) - m(0, 0) * m(2, 1)) * id;
+  x(2, 2) = (m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0)) * id;
+  return x;
+}
+
+/// Inverse of 4x4 matrix, by 2x2 minors.
+template <typename T>
+constexpr auto inverse(mat<T, 4, 4> const &m,
+                       std::integral_constant<size_t, 4>) {
+  minors4<T> const    n(m);
+  auto const          id = 1 / n.det();
+  mat<inv_t<T>, 4, 4> x;
+  x(0, 0) = (m(1, 1) * n.c5 - m(1, 2) * n.c4 + m(1, 3) * n.c3) * id;
+  x(0, 1) = (m(0, 2) * n.c4 - m(0, 1) * n.c5 - m(0, 3) * n.c3) * id;
+  x(0, 2) = (m(3, 1) * n.s5 - m(3, 2) * n.s4 + m(3, 3) * n.s3) * id;
+  x(0, 3) = (m(2, 2) * n.s4 - m(2, 1) * n.s5 - m(2, 3) * n.s3) * id;
+  x(1, 0) = (m(1, 2) * n.c2 - m(1, 0) * n.c5 - m(1, 3) * n.c1) * id;
+  x(1, 1) = (m(0, 0) * n.c5 - m(0, 2) * n.c2 + m(0, 3) * n.c1) * id;
+  x(1, 2) = (m(3, 2) * n.s2 - m(3, 0) * n.s5 - m(3, 3) * n.s1) * id;
+  x(1, 3) = (m(2, 0) * n.s5 - m(2, 2) * n.s2 + m(2, 3) * n.s1) * id;
+  x(2, 0) = (m(1, 0) * n.c4 - m(1, 1) * n.c2 + m(1, 3) * n.c0) * id;
+  x(2, 1) = (m(0, 1) * n.c2 - m(0, 0) * n.c4 - m(0, 3) * n.c0) * id;
+  x(2, 2) = (m(3, 0) * n.s4 - m(3, 1) * n.s2 + m(3, 3) * n.s0) * id;
+  x(2, 3) = (m(2, 1) * n.s2 - m(2, 0) * n.s4 - m(2, 3) * n.s0) * id;
+  x(3, 0) = (m(1, 1) * n.c1 - m(1, 0) * n.c3 - m(1, 2) * n.c0) * id;
+  x(3, 1) = (m(0, 0) * n.c3 - m(0, 1) * n.c1 + m(0, 2) * n.c0) * id;
+  x(3, 2) = (m(3, 1) * n.s1 - m(3, 0) * n.s3 - m(3, 2) * n.s0) * id;
+  x(3, 3) = (m(2, 0) * n.s3 - m(2, 1) * n.s1 + m(2, 2) * n.s0) * id;
+  return x;
+}
+
+/// Inverse of larger matrix, by LU-decomposition.
+template <typename T, size_t N, size_t K>
+constexpr auto inverse(mat<T, N, N> const &m,
+                       std::integral_constant<size_t, K>) {
+  return lu<T, N>(m).inverse();
+}
+
+
+} // namespace impl
+
+
+/// Determinant of square matrix.
+///
+/// A closed form is used for 2x2, 3x3, and 4x4; LU-decomposition with partial
+/// pivoting is used for larger matrices, such as 6x6.  If each element be a
+/// quantity, then the determinant has the N-th power of its dimension.
+template <typename T, size_t N> constexpr auto det(mat<T, N, N> const &m) {
+  return impl::det(m, std::integral_constant<size_t, N>());
+}
+
+/// Inverse of square matrix.
+///
+/// A closed form is used for 2x2, 3x3, and 4x4; LU-decomposition with partial
+/// pivoting is used for larger matrices, such as 6x6.  If each element be a
+/// quantity, then each element of the inverse has the reciprocal dimension.
+/// A singular matrix produces infinite or NaN elements.
+template <typename T, size_t N> constexpr auto inverse(mat<T, N, N> const &m) {
+  return impl::inverse(m, std::integral_constant<size_t, N>());
+}
+
+/// Inverse of square matrix, found by argument-dependent look-up when the
+/// matrix is the numeric part of a vnix::units::dimval.
+template <typename T, size_t N> constexpr auto invert(mat<T, N, N> const &m) {
+  return inverse(m);
+}
+
+
+/// Print matrix.
+template <typename T, size_t NR, size_t NC>
+std::ostream &operator<<(std::ostream &os, mat<T, NR, NC> const &m) {
+  for (size_t i = 0; i < NR; ++i) {
+    auto const rowi = m.row(i);
+    os << std::endl;
+    for (size_t j = 0; j < NC; ++j) { os << rowi(j) << "  "; }
+  }
+  return os;
+}
+
+
+} // namespace mv
+} // namespace vnix
+
+#endif // ndef VNIX_MV_MAT_HPP
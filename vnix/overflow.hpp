@@ -0,0 +1,83 @@
+/// @file       vnix/overflow.hpp
+/// @brief      Definition of vnix::add_overflow, vnix::sub_overflow, and
+///             vnix::mul_overflow.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD Three-Clause; see LICENSE.
+
+#ifndef VNIX_OVERFLOW_HPP
+#define VNIX_OVERFLOW_HPP
+
+#ifndef __GNUC__
+#include <limits> // for numeric_limits
+#endif
+
+namespace vnix {
+
+
+// With g++ or clang++, each function here is the corresponding builtin, which
+// uses the processor's flag of overflow and is allowed in a constant
+// expression.  Otherwise, each is a portable check before the operation.
+
+
+/// Sum of two integers, with detection of overflow.
+/// @tparam T  Type of integer.
+/// @param  a  Addend.
+/// @param  b  Adder.
+/// @param  r  Pointer to sum, which is stored only if there be no overflow.
+/// @return    True only if the sum overflow T.
+template <typename T> constexpr bool add_overflow(T a, T b, T *r) {
+#ifdef __GNUC__
+  return __builtin_add_overflow(a, b, r);
+#else
+  using lim = std::numeric_limits<T>;
+  if (b > 0 ? a > lim::max() - b : a < lim::min() - b) { return true; }
+  *r = a + b;
+  return false;
+#endif
+}
+
+
+/// Difference between two integers, with detection of overflow.
+/// @tparam T  Type of integer.
+/// @param  a  Minuend.
+/// @param  b  Subtrahend.
+/// @param  r  Pointer to difference, stored only if there be no overflow.
+/// @return    True only if the difference overflow T.
+template <typename T> constexpr bool sub_overflow(T a, T b, T *r) {
+#ifdef __GNUC__
+  return __builtin_sub_overflow(a, b, r);
+#else
+  using lim = std::numeric_limits<T>;
+  if (b < 0 ? a > lim::max() + b : a < lim::min() + b) { return true; }
+  *r = a - b;
+  return false;
+#endif
+}
+
+
+/// Product of two integers, with detection of overflow.
+/// @tparam T  Type of integer.
+/// @param  a  Multiplicand.
+/// @param  b  Multiplier.
+/// @param  r  Pointer to product, stored only if there be no overflow.
+/// @return    True only if the product overflow T.
+template <typename T> constexpr bool mul_overflow(T a, T b, T *r) {
+#ifdef __GNUC__
+  return __builtin_mul_overflow(a, b, r);
+#else
+  using lim = std::numeric_limits<T>;
+  if (a != 0 && b != 0) {
+    if (a > 0 ? (b > 0 ? a > lim::max() / b : b < lim::min() / a)
+              : (b > 0 ? a < lim::min() / b : b < lim::max() / a)) {
+      return true;
+    }
+  }
+  *r = a * b;
+  return false;
+#endif
+}
+
+
+} // namespace vnix
+
+#endif // ndef VNIX_OVERFLOW_HPP
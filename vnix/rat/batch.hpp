@@ -0,0 +1,186 @@
+/// @file       vnix/rat/batch.hpp
+/// @brief      Arithmetic on arrays of vnix::rat::rational.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD Three-Clause; see LICENSE.
+
+#ifndef VNIX_RAT_BATCH_HPP
+#define VNIX_RAT_BATCH_HPP
+
+#include <cstddef>               // for size_t
+#include <vnix/error.hpp>        // for error
+#include <vnix/gcd.hpp>          // for gcd
+#include <vnix/overflow.hpp>     // for add_overflow, mul_overflow
+#include <vnix/rat/rational.hpp> // for rational
+
+namespace vnix {
+namespace rat {
+namespace impl {
+
+
+/// Sum or difference of two rationals of the same type.
+///
+/// This follows Knuth (TAOCP, volume 2, section 4.5.1): after the numerator
+/// is computed over the reduced common denominator, the only gcd still needed
+/// is that of the numerator and the gcd of the denominators, which is no
+/// larger than either denominator.  The result is in lowest terms and so is
+/// not normalized again.  On overflow of the fast type, the generic operator
+/// is used instead.
+///
+/// @tparam NB   Number of bits for numerator.
+/// @tparam DB   Number of bits for denominator.
+/// @param  a    Left-hand operand.
+/// @param  b    Right-hand operand.
+/// @param  neg  True for difference; false for sum.
+/// @return      Sum or difference.
+template <unsigned NB, unsigned DB>
+constexpr rational<NB, DB> sum(rational<NB, DB> a, rational<NB, DB> b,
+                               bool neg) {
+  using R      = rational<NB, DB>;
+  using S      = typename R::sftype;
+  using U      = typename R::uftype;
+  using pair   = normalized_pair<NB, DB>;
+  S const ad   = a.d();
+  S const bd   = b.d();
+  S const g    = S(gcd(ad, bd));
+  S const adg  = ad / g;
+  S const bn   = (neg ? -S(b.n()) : S(b.n())); // S is wider than numerator.
+  S       t    = 0; // Numerator over ad * bd / g.
+  S       u    = 0; // Right-hand contribution to t.
+  S       d    = 0; // Reduced denominator.
+  bool    ovfl = mul_overflow(S(a.n()), S(bd / g), &t) ||
+                 mul_overflow(bn, adg, &u) || add_overflow(t, u, &t);
+  if (!ovfl) {
+    S const g2 = S(gcd(t, g));
+    ovfl       = mul_overflow(adg, S(bd / g2), &d);
+    if (!ovfl) { return R(pair(t / g2, U(d), typename pair::lowest_terms())); }
+  }
+  return neg ? R(a - b) : R(a + b);
+}
+
+
+/// Product or quotient of two rationals of the same type.
+///
+/// Each numerator is reduced by the other denominator before multiplication,
+/// so that the result is in lowest terms and is not normalized again.  On
+/// overflow of the fast type, the generic operator is used instead.
+///
+/// @tparam NB   Number of bits for numerator.
+/// @tparam DB   Number of bits for denominator.
+/// @param  a    Left-hand operand.
+/// @param  b    Right-hand operand, which is nonzero for quotient.
+/// @param  inv  True for quotient; false for product.
+/// @return      Product or quotient.
+template <unsigned NB, unsigned DB>
+constexpr rational<NB, DB> product(rational<NB, DB> a, rational<NB, DB> b,
+                                   bool inv) {
+  using R    = rational<NB, DB>;
+  using S    = typename R::sftype;
+  using U    = typename R::uftype;
+  using pair = normalized_pair<NB, DB>;
+  S bn       = b.n();
+  S bd       = b.d();
+  if (inv) {
+    // Reciprocal, whose denominator must be positive.
+    S const t = bn;
+    bn        = (t < 0 ? -bd : bd);
+    bd        = (t < 0 ? -t : t);
+  }
+  S const ga = S(gcd(a.n(), bd));
+  S const gb = S(gcd(bn, a.d()));
+  S       n  = 0, d = 0;
+  if (mul_overflow(S(a.n() / ga), S(bn / gb), &n) ||
+      mul_overflow(S(a.d() / gb), S(bd / ga), &d)) {
+    return inv ? R(a / b) : R(a * b);
+  }
+  return R(pair(n, U(d), typename pair::lowest_terms()));
+}
+
+
+} // namespace impl
+
+
+/// Sum of corresponding elements of two arrays.
+///
+/// Each result is what `R(a[i] + b[i])` would be, but is computed with fewer
+/// operations on the common type.  The result may overwrite either operand.
+///
+/// @tparam NB  Number of bits for numerator.
+/// @tparam DB  Number of bits for denominator.
+/// @param  a   Array of addends.
+/// @param  b   Array of adders.
+/// @param  r   Array of sums.
+/// @param  n   Number of elements.
+template <unsigned NB, unsigned DB>
+void add(rational<NB, DB> const *a, rational<NB, DB> const *b,
+         rational<NB, DB> *r, size_t n) {
+  for (size_t i = 0; i < n; ++i) { r[i] = impl::sum(a[i], b[i], false); }
+}
+
+
+/// Difference between corresponding elements of two arrays.
+/// @tparam NB  Number of bits for numerator.
+/// @tparam DB  Number of bits for denominator.
+/// @param  a   Array of minuends.
+/// @param  b   Array of subtrahends.
+/// @param  r   Array of differences.
+/// @param  n   Number of elements.
+template <unsigned NB, unsigned DB>
+void subtract(rational<NB, DB> const *a, rational<NB, DB> const *b,
+              rational<NB, DB> *r, size_t n) {
+  for (size_t i = 0; i < n; ++i) { r[i] = impl::sum(a[i], b[i], true); }
+}
+
+
+/// Product of corresponding elements of two arrays.
+/// @tparam NB  Number of bits for numerator.
+/// @tparam DB  Number of bits for denominator.
+/// @param  a   Array of multiplicands.
+/// @param  b   Array of multipliers.
+/// @param  r   Array of products.
+/// @param  n   Number of elements.
+template <unsigned NB, unsigned DB>
+void multiply(rational<NB, DB> const *a, rational<NB, DB> const *b,
+              rational<NB, DB> *r, size_t n) {
+  for (size_t i = 0; i < n; ++i) { r[i] = impl::product(a[i], b[i], false); }
+}
+
+
+/// Quotient of corresponding elements of two arrays.
+/// @tparam NB  Number of bits for numerator.
+/// @tparam DB  Number of bits for denominator.
+/// @param  a   Array of dividends.
+/// @param  b   Array of divisors.
+/// @param  r   Array of quotients.
+/// @param  n   Number of elements.
+template <unsigned NB, unsigned DB>
+void divide(rational<NB, DB> const *a, rational<NB, DB> const *b,
+            rational<NB, DB> *r, size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    if (b[i].n() == 0) {
+      error("attempt to take reciprocal of zero");
+      return;
+    }
+    r[i] = impl::product(a[i], b[i], true);
+  }
+}
+
+
+/// Sum of the elements of an array, accumulated in the type of each element,
+/// as by `s += a[i]` for each element.
+/// @tparam NB  Number of bits for numerator.
+/// @tparam DB  Number of bits for denominator.
+/// @param  a   Array of elements.
+/// @param  n   Number of elements.
+/// @return     Sum.
+template <unsigned NB, unsigned DB>
+rational<NB, DB> sum(rational<NB, DB> const *a, size_t n) {
+  rational<NB, DB> s;
+  for (size_t i = 0; i < n; ++i) { s = impl::sum(s, a[i], false); }
+  return s;
+}
+
+
+} // namespace rat
+} // namespace vnix
+
+#endif // ndef VNIX_RAT_BATCH_HPP
@@ -6,8 +6,10 @@
 #ifndef VNIX_RAT_COMMON_DENOM_HPP
 #define VNIX_RAT_COMMON_DENOM_HPP
 
+#include <vnix/error.hpp>     // for error
 #include <vnix/gcd.hpp>       // for gcd
 #include <vnix/int-types.hpp> // for int_types
+#include <vnix/overflow.hpp>  // for mul_overflow
 
 namespace vnix {
 namespace rat {
@@ -40,7 +42,19 @@ common_denom(rational<NB1, DB1> r1, rational<NB2, DB2> r2) {
   gcd_t const g   = gcd(r1.d(), r2.d()); // GCD of input denominators.
   UF1 const   d1g = r1.d() / g; // First input denominator divided by g.
   UF2 const   d2g = r2.d() / g; // Second input denominator divided by g.
-  return cdp(d1g * r2.d(), r1.n() * d2g, r2.n() * d1g);
+  using lcd_t     = typename cdp::lcd_t;
+  using n1_t      = typename cdp::n1_t;
+  using n2_t      = typename cdp::n2_t;
+  // Overflow is possible only where the width of a type is clamped at 64.
+  lcd_t lcd = 0;
+  n1_t  n1  = 0;
+  n2_t  n2  = 0;
+  if (mul_overflow(lcd_t(d1g), lcd_t(r2.d()), &lcd) ||
+      mul_overflow(n1_t(r1.n()), n1_t(d2g), &n1) ||
+      mul_overflow(n2_t(r2.n()), n2_t(d1g), &n2)) {
+    error("overflow of common denominator");
+  }
+  return cdp(lcd, n1, n2);
 };
 
 
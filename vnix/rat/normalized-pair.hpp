@@ -7,6 +7,7 @@
 #define VNIX_RAT_NORMALIZED_PAIR_HPP
 
 #include <utility>            // for pair
+#include <vnix/error.hpp>     // for error
 #include <vnix/gcd.hpp>       // for gcd
 #include <vnix/int-types.hpp> // for int_types
 
@@ -38,12 +39,34 @@ template <unsigned NMR_BITS, unsigned DNM_BITS> class normalized_pair {
   /// @param d  Input denominator.
   /// @return   Normalized numerator and denominator.
   constexpr static std::pair<S, U> pair(S n, S d) {
-    U const g = gcd(n, d);
-    if (d < 0) { return {-n / g, -d / g}; }
-    return {n / g, d / g};
+    // The gcd is signed so that a negative numerator be divided correctly.
+    S const g = S(gcd(n, d));
+    if (d < 0) { return {-n / g, U(-d / g)}; }
+    return {n / g, U(d / g)};
+  }
+
+  /// Throw if numerator or denominator not fit in its allocation of bits.
+  ///
+  /// In the common case, where each fits, there is one unsigned comparison
+  /// for each; the message is chosen only on failure.
+  constexpr void check() const {
+    enum {
+      NMAX = U(1) << (NMR_BITS - 1), // maximum magnitude of numerator
+      DMAX = U(1) << (DNM_BITS)      // maximum value of denominator
+    };
+    // Numerator shifted into [0, 2 * NMAX) if it be in range.
+    U const shifted = U(U(n()) + U(NMAX));
+    if (shifted <= U(U(NMAX) + U(NMAX - 1)) && d() <= U(DMAX)) { return; }
+    if (n() >= NMAX) { error("numerator too large and positive"); }
+    if (n() < -NMAX) { error("numerator too large and negative"); }
+    if (d() > +DMAX) { error("denominator too large"); }
   }
 
 public:
+  /// Tag for construction from a numerator and a positive denominator that
+  /// are already relatively prime.
+  struct lowest_terms {};
+
   /// Initialize normalized numerator and denominator for encoding of rational
   /// number.
   ///
@@ -54,14 +77,18 @@ public:
   /// @param nn  Initial numerator.
   /// @param dd  Initial denominator.
   constexpr normalized_pair(S nn, S dd) : pair_(pair(nn, dd)) {
-    enum {
-      NMAX = U(1) << (NMR_BITS - 1), // maximum magnitude of numerator
-      DMAX = U(1) << (DNM_BITS)      // maximum value of denominator
-    };
-    if (dd == 0) { throw "null denominator (division by zero)"; }
-    if (n() >= NMAX) { throw "numerator too large and positive"; }
-    if (n() < -NMAX) { throw "numerator too large and negative"; }
-    if (d() > +DMAX) { throw "denominator too large"; }
+    if (dd == 0) { error("null denominator (division by zero)"); }
+    check();
+  }
+
+  /// Initialize from numerator and denominator already in lowest terms, as
+  /// computed by a kernel that has reduced them, so that only the range of
+  /// each is checked.
+  ///
+  /// @param nn  Numerator.
+  /// @param dd  Positive denominator, relatively prime to numerator.
+  constexpr normalized_pair(S nn, U dd, lowest_terms) : pair_(nn, dd) {
+    check();
   }
 
   constexpr S n() const { return pair_.first; }  ///< Normalized numerator.
@@ -7,6 +7,8 @@
 #define VNIX_RAT_RATIONAL_HPP
 
 #include <iostream>
+#include <vnix/error.hpp>
+#include <vnix/overflow.hpp>
 #include <vnix/rat/common-denom.hpp>
 #include <vnix/rat/encoding.hpp>
 
@@ -47,6 +49,10 @@ public:
   constexpr rational(stype n = 0, stype d = 1)
       : P(normalized_pair<NB, DB>(n, d)) {}
 
+  /// Initialize from normalized numerator and denominator.
+  /// @param p  Normalized numerator and denominator.
+  constexpr explicit rational(normalized_pair<NB, DB> p) : P(p) {}
+
   /// Initialize from other rational.
   /// @tparam ONB  Number of numerator-bits in other type of rational.
   /// @tparam ODB  Number of denominator-bits in other type of rational.
@@ -57,7 +63,7 @@ public:
 
   /// Convert to (signed) integer.
   constexpr stype to_int() const {
-    if (d() != 1) { throw "attempted conversion to integer from fraction"; }
+    if (d() != 1) { error("attempted conversion to integer from fraction"); }
     return n();
   }
 
@@ -88,7 +94,10 @@ public:
 
   /// Reciprocal of this rational number.
   constexpr rational reciprocal() const {
-    if (n() == 0) { throw "attempt to take reciprocal of zero"; }
+    if (n() == 0) {
+      error("attempt to take reciprocal of zero");
+      return rational();
+    }
     if (n() < 0) { return rational(-d(), -n()); }
     return rational(d(), n());
   }
@@ -230,7 +239,10 @@ constexpr auto operator-(rational<NB, DB> r) {
 template <unsigned NB1, unsigned DB1, unsigned NB2, unsigned DB2>
 constexpr auto operator+(rational<NB1, DB1> r1, rational<NB2, DB2> r2) {
   auto const c = common_denom(r1, r2);
-  return rational<c.NMR_BITS, c.LCD_BITS>(c.n1 + c.n2, c.lcd);
+  using S       = typename rational<c.NMR_BITS, c.LCD_BITS>::stype;
+  S n           = 0;
+  if (add_overflow(S(c.n1), S(c.n2), &n)) { error("numerator too large"); }
+  return rational<c.NMR_BITS, c.LCD_BITS>(n, c.lcd);
 }
 
 
@@ -280,12 +292,20 @@ constexpr auto operator*(rational<NB1, DB1> r1, rational<NB2, DB2> r2) {
   auto const n2 = r2.n();
   auto const d1 = r1.d();
   auto const d2 = r2.d();
-  auto const ga = gcd(n1, d2);
-  auto const gb = gcd(n2, d1);
   enum { NB = (NB1 > NB2 ? NB1 : NB2), DB = (DB1 > DB2 ? DB1 : DB2) };
-  using S = typename int_types<NB>::SF;
-  using U = typename int_types<DB>::UF;
-  return rational<NB, DB>(S(n1) / ga * n2 / gb, U(d1) / gb * d2 / ga);
+  using S = typename rational<NB, DB>::stype;
+  // Each factor is reduced before multiplication, and, because the division
+  // is signed, a negative numerator is divided correctly by an unsigned gcd.
+  S const ga = S(gcd(n1, d2));
+  S const gb = S(gcd(n2, d1));
+  S       n  = 0, d = 0;
+  if (mul_overflow(S(S(n1) / ga), S(S(n2) / gb), &n)) {
+    error("numerator too large");
+  }
+  if (mul_overflow(S(S(d1) / gb), S(S(d2) / ga), &d)) {
+    error("denominator too large");
+  }
+  return rational<NB, DB>(n, d);
 }
 
 
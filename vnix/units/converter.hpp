@@ -0,0 +1,162 @@
+/// @file       vnix/units/converter.hpp
+/// @brief      Definition of vnix::units::basic_converter and converter().
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD Three-Clause; see LICENSE.
+
+#ifndef VNIX_UNITS_CONVERTER_HPP
+#define VNIX_UNITS_CONVERTER_HPP
+
+#include <cstddef>                  // for size_t
+#include <functional>               // for hash
+#include <mutex>                    // for unique_lock
+#include <shared_mutex>             // for shared_timed_mutex, shared_lock
+#include <string>                   // for string
+#include <unordered_map>            // for unordered_map
+#include <utility>                  // for pair
+#include <vnix/units/unit-expr.hpp> // for parse_unit
+
+namespace vnix {
+namespace units {
+
+
+/// Precomputed conversion of numbers from one unit to another unit of the
+/// same dimension.
+///
+/// The dimensions are checked once, on construction, and the two units'
+/// scale-factors are fused into a single factor.  Thereafter, each conversion
+/// is a single multiplication.
+///
+/// @tparam T  Type of number (float, double, etc.).
+template <typename T> class basic_converter {
+  T   f_; ///< Number of target-units in one source-unit.
+  dim d_; ///< Dimension shared by source-unit and target-unit.
+
+public:
+  /// Initialize from scale-factor and dimension of each unit.
+  /// This will throw an exception if the dimensions are different.
+  /// @param from  Source-unit.
+  /// @param to    Target-unit.
+  basic_converter(unit_spec const &from, unit_spec const &to)
+      : f_(T(from.sf / to.sf)), d_(from.d) {
+    if (from.d != to.d) { error("incompatible units for conversion"); }
+  }
+
+  /// Initialize from expression of each unit, such as "ft" and "km".
+  /// This will throw an exception if the dimensions are different.
+  /// @param from  Source-unit.
+  /// @param to    Target-unit.
+  basic_converter(std::string const &from, std::string const &to)
+      : basic_converter(parse_unit(from), parse_unit(to)) {}
+
+  /// Initialize from dimensioned quantity for each unit, such as
+  /// vnix::units::dbl::ft and vnix::units::dbl::km.
+  /// This will throw an exception if the dimensions are different.
+  /// @tparam T1  Numeric type of source-unit.
+  /// @tparam B1  Base-dimension type of source-unit.
+  /// @tparam T2  Numeric type of target-unit.
+  /// @tparam B2  Base-dimension type of target-unit.
+  /// @param  from  Source-unit.
+  /// @param  to    Target-unit.
+  template <typename T1, typename B1, typename T2, typename B2>
+  basic_converter(dimval<T1, B1> const &from, dimval<T2, B2> const &to)
+      : basic_converter(unit_spec{from.raw_number(), from.d()},
+                        unit_spec{to.raw_number(), to.d()}) {}
+
+  T   factor() const { return f_; } ///< Number of target-units per source.
+  dim d() const { return d_; }      ///< Dimension of both units.
+
+  /// Convert number of source-units to number of target-units.
+  /// @param x  Number of source-units.
+  T apply(T x) const {
+    VNIX_UNITS_COUNT(convert);
+    return x * f_;
+  }
+
+  /// Convert array of numbers of source-units to numbers of target-units.
+  /// @param in   Pointer to first number of source-units.
+  /// @param n    Number of numbers.
+  /// @param out  Pointer to first number of target-units (may equal in).
+  void apply(T const *in, size_t n, T *out) const {
+    VNIX_UNITS_COUNT_N(convert, n);
+    T const f = f_; // Local copy lets compiler see no aliasing of factor.
+    for (size_t i = 0; i < n; ++i) { out[i] = in[i] * f; }
+  }
+
+  /// Convert, in place, array of numbers of source-units to numbers of
+  /// target-units.
+  /// @param x  Pointer to first number.
+  /// @param n  Number of numbers.
+  void apply(T *x, size_t n) const { apply(x, n, x); }
+};
+
+
+/// Process-wide cache of converters, keyed by pair of expressions of units.
+/// @tparam T  Type of number (float, double, etc.).
+template <typename T> class converter_cache {
+  using key = std::pair<std::string, std::string>; ///< Source and target.
+
+  /// Hash of pair of strings.
+  struct hash {
+    /// Combine hash of each string.
+    /// @param k  Pair of strings.
+    size_t operator()(key const &k) const {
+      std::hash<std::string> h;
+      return h(k.first) * 31 + h(k.second);
+    }
+  };
+
+  std::unordered_map<key, basic_converter<T>, hash> map_; ///< Converters.
+  mutable std::shared_timed_mutex mutex_; ///< Guard for map.
+
+  converter_cache() {} ///< Allow construction only by instance().
+
+public:
+  /// Single instance of cache.
+  static converter_cache &instance() {
+    static converter_cache c;
+    return c;
+  }
+
+  /// Find converter, or build and insert it if absent.
+  ///
+  /// The reference returned remains valid for the life of the process.  This
+  /// will throw an exception if the dimensions of the units differ.
+  ///
+  /// @param from  Expression of source-unit.
+  /// @param to    Expression of target-unit.
+  basic_converter<T> const &get(std::string const &from,
+                                std::string const &to) {
+    key const k(from, to);
+    {
+      std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+      auto const                                i = map_.find(k);
+      if (i != map_.end()) { return i->second; }
+    }
+    basic_converter<T> const                  c(from, to); // Outside lock.
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    return map_.emplace(k, c).first->second;
+  }
+
+  /// Number of converters in cache.
+  size_t size() const {
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    return map_.size();
+  }
+};
+
+
+/// Find converter in process-wide cache, or build and insert it if absent.
+/// @tparam T     Type of number (float, double, etc.).
+/// @param  from  Expression of source-unit, such as "erg".
+/// @param  to    Expression of target-unit, such as "mJ".
+template <typename T>
+basic_converter<T> const &converter(std::string const &from,
+                                    std::string const &to) {
+  return converter_cache<T>::instance().get(from, to);
+}
+
+
+} // namespace units
+} // namespace vnix
+
+#endif // ndef VNIX_UNITS_CONVERTER_HPP
@@ -0,0 +1,196 @@
+/// @file       vnix/units/counters.hpp
+/// @brief      Definition of vnix::units::counters and VNIX_UNITS_COUNT.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD Three-Clause; see LICENSE.
+///
+/// When VNIX_UNITS_COUNTERS is defined before the first inclusion of any
+/// header of the library, each dimension-check, mismatch, throw, combination
+/// or transformation of exponents, power, square-root, and conversion of
+/// scale that happens at run-time is counted in a counter local to the
+/// calling thread.  Otherwise, VNIX_UNITS_COUNT expands to nothing, and there
+/// is no cost.  Every translation-unit in a program must agree on the
+/// definition of VNIX_UNITS_COUNTERS.
+///
+/// Because the dimension of a basic_statdim is computed at compile-time, a
+/// counter tells how much work remains at run-time, and so which code would
+/// benefit from migration from basic_dyndim to basic_statdim.
+
+#ifndef VNIX_UNITS_COUNTERS_HPP
+#define VNIX_UNITS_COUNTERS_HPP
+
+#include <atomic>   // for atomic
+#include <cstdint>  // for uint64_t
+#include <mutex>    // for mutex, lock_guard
+#include <ostream>  // for ostream
+#include <vector>   // for vector
+
+namespace vnix {
+namespace units {
+
+
+/// Kind of event counted when VNIX_UNITS_COUNTERS is defined.
+enum class counter : unsigned {
+  check,     ///< Comparison of dimensions at run-time.
+  mismatch,  ///< Comparison that found different dimensions.
+  throws,    ///< Exception thrown for dimension.
+  combine,   ///< Combination of exponents of two dims, one by one.
+  transform, ///< Transformation of exponents of dim, one by one.
+  power,     ///< Rational power of dimension.
+  sqrt,      ///< Square-root of dimension.
+  convert,   ///< Multiplication of number by factor of scale of unit.
+  NUM        ///< Number of kinds of event.
+};
+
+
+/// Counts of events, one for each kind.
+struct counts {
+  uint64_t n[unsigned(counter::NUM)] = {}; ///< Count for each kind.
+
+  /// Count for kind of event.
+  /// @param c  Kind of event.
+  uint64_t operator[](counter c) const { return n[unsigned(c)]; }
+
+  /// Add other counts.
+  /// @param o  Other counts.
+  counts &operator+=(counts const &o) {
+    for (unsigned i = 0; i < unsigned(counter::NUM); ++i) { n[i] += o.n[i]; }
+    return *this;
+  }
+};
+
+
+/// Per-thread counters of events, with a report summed over threads.
+///
+/// Each thread increments its own counters without a lock or an atomic
+/// read-modify-write.  When a thread exits, its counts are folded into a
+/// process-wide total, so that nothing is lost.
+class counters {
+  /// Counters of one thread.
+  struct block {
+    std::atomic<uint64_t> n[unsigned(counter::NUM)]; ///< Count of each kind.
+
+    block() {
+      for (auto &c : n) { c.store(0, std::memory_order_relaxed); }
+      std::lock_guard<std::mutex> lock(reg().mtx);
+      reg().live.push_back(this);
+    }
+
+    ~block() {
+      std::lock_guard<std::mutex> lock(reg().mtx);
+      reg().dead += snap();
+      auto &live = reg().live;
+      for (size_t i = 0; i < live.size(); ++i) {
+        if (live[i] == this) {
+          live[i] = live.back();
+          live.pop_back();
+          break;
+        }
+      }
+    }
+
+    /// Copy of counts.
+    counts snap() const {
+      counts c;
+      for (unsigned i = 0; i < unsigned(counter::NUM); ++i) {
+        c.n[i] = n[i].load(std::memory_order_relaxed);
+      }
+      return c;
+    }
+  };
+
+  /// Registry of every thread's counters.
+  struct registry {
+    std::mutex           mtx;  ///< Lock on registry.
+    std::vector<block *> live; ///< Counters of each running thread.
+    counts               dead; ///< Sum of counters of exited threads.
+  };
+
+  /// Process-wide registry.
+  static registry &reg() {
+    static registry r;
+    return r;
+  }
+
+  /// Counters of calling thread.
+  static block &local() {
+    thread_local block b;
+    return b;
+  }
+
+public:
+  /// Count event in calling thread.
+  /// @param c  Kind of event.
+  /// @param k  Number of events.
+  static void bump(counter c, uint64_t k = 1) {
+    auto &n = local().n[unsigned(c)];
+    n.store(n.load(std::memory_order_relaxed) + k, std::memory_order_relaxed);
+  }
+
+  /// Counts in calling thread.
+  static counts thread() { return local().snap(); }
+
+  /// Counts summed over every thread, running or exited.
+  static counts total() {
+    local(); // Register calling thread before taking lock.
+    std::lock_guard<std::mutex> lock(reg().mtx);
+    counts                      c = reg().dead;
+    for (auto b : reg().live) { c += b->snap(); }
+    return c;
+  }
+
+  /// Reset every count in every thread to zero.
+  static void reset() {
+    local();
+    std::lock_guard<std::mutex> lock(reg().mtx);
+    reg().dead = counts();
+    for (auto b : reg().live) {
+      for (auto &n : b->n) { n.store(0, std::memory_order_relaxed); }
+    }
+  }
+
+  /// Name of kind of event.
+  /// @param c  Kind of event.
+  static char const *name(counter c) {
+    static char const *const names[] = {"check",  "mismatch", "throws",
+                                        "combine", "transform", "power",
+                                        "sqrt",   "convert"};
+    return names[unsigned(c)];
+  }
+
+  /// Print counts summed over every thread, one line for each kind.
+  /// @param os  Stream to which counts are printed.
+  static std::ostream &dump(std::ostream &os) {
+    counts const c = total();
+    for (unsigned i = 0; i < unsigned(counter::NUM); ++i) {
+      os << name(counter(i)) << " " << c.n[i] << "\n";
+    }
+    return os;
+  }
+};
+
+
+} // namespace units
+} // namespace vnix
+
+
+#ifdef VNIX_UNITS_COUNTERS
+#if defined(__GNUC__) && (__GNUC__ >= 9 || defined(__clang__))
+/// Count event of kind c if not in constant evaluation.
+#define VNIX_UNITS_COUNT(c)                                                    \
+  (__builtin_is_constant_evaluated()                                           \
+       ? void()                                                                \
+       : ::vnix::units::counters::bump(::vnix::units::counter::c))
+/// Count k events of kind c if not in constant evaluation.
+#define VNIX_UNITS_COUNT_N(c, k)                                               \
+  (__builtin_is_constant_evaluated()                                           \
+       ? void()                                                                \
+       : ::vnix::units::counters::bump(::vnix::units::counter::c, k))
+#else
+#error "VNIX_UNITS_COUNTERS requires __builtin_is_constant_evaluated()."
+#endif
+#elif !defined(VNIX_UNITS_COUNT)
+#define VNIX_UNITS_COUNT(c) ((void)0)
+#define VNIX_UNITS_COUNT_N(c, k) ((void)0)
+#endif
+
+#endif // ndef VNIX_UNITS_COUNTERS_HPP
@@ -0,0 +1,379 @@
+/// @file       vnix/units/csv.hpp
+/// @brief      Definition of vnix::units::basic_csv_reader and write_csv().
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD Three-Clause; see LICENSE.
+
+#ifndef VNIX_UNITS_CSV_HPP
+#define VNIX_UNITS_CSV_HPP
+
+#include <algorithm>                // for max, min
+#include <cstdio>                   // for snprintf
+#include <cstdlib>                  // for strtod, strtof, strtold
+#include <istream>                  // for istream
+#include <limits>                   // for numeric_limits
+#include <ostream>                  // for ostream
+#include <string>                   // for string
+#include <thread>                   // for thread
+#include <vector>                   // for vector
+#include <vnix/units/table.hpp>     // for basic_table
+#include <vnix/units/unit-expr.hpp> // for parse_unit
+
+#if __cplusplus >= 201703L
+#include <charconv> // for from_chars
+#endif
+
+namespace vnix {
+namespace units {
+
+
+/// Name and unit of a column in a CSV-file whose header is annotated with
+/// units, as in "t[s],x[km],F[mN]".
+struct csv_field {
+  std::string name; ///< Name of column.
+  std::string unit; ///< Expression of unit (empty for dimensionless).
+  unit_spec   u;    ///< Scale-factor and dimension of unit.
+};
+
+
+namespace impl {
+
+
+/// Parse a number at the beginning of a range of characters.
+///
+/// With C++17, std::from_chars is used.  Otherwise, the C library's strtod
+/// and its siblings are used; these require that the range be followed
+/// eventually by a character that cannot be part of a number.
+///
+/// @tparam T  Type of number.
+/// @param  b  Pointer to first character.
+/// @param  e  Pointer past last character.
+/// @param  x  Reference to storage for number.
+/// @return    Pointer past last character of number.
+template <typename T>
+inline char const *parse_number(char const *b, char const *e, T &x) {
+  while (b != e && (*b == ' ' || *b == '\t')) { ++b; }
+  if (b == e || *b == ',' || *b == '\r') { error("missing number in CSV"); }
+#if __cplusplus >= 201703L && defined(__cpp_lib_to_chars)
+  if (b != e && *b == '+') { ++b; }
+  auto const r = std::from_chars(b, e, x);
+  if (r.ec != std::errc()) { error("bad number in CSV"); }
+  return r.ptr;
+#else
+  char *      end = nullptr;
+  long double lx  = std::strtold(b, &end);
+  if (end == b) { error("bad number in CSV"); }
+  x = T(lx);
+  return end;
+#endif
+}
+
+#if !(__cplusplus >= 201703L && defined(__cpp_lib_to_chars))
+/// Parse a float via strtof.
+template <>
+inline char const *parse_number(char const *b, char const *e, float &x) {
+  while (b != e && (*b == ' ' || *b == '\t')) { ++b; }
+  if (b == e || *b == ',' || *b == '\r') { error("missing number in CSV"); }
+  char *end = nullptr;
+  x         = std::strtof(b, &end);
+  if (end == b) { error("bad number in CSV"); }
+  return end;
+}
+
+/// Parse a double via strtod.
+template <>
+inline char const *parse_number(char const *b, char const *e, double &x) {
+  while (b != e && (*b == ' ' || *b == '\t')) { ++b; }
+  if (b == e || *b == ',' || *b == '\r') { error("missing number in CSV"); }
+  char *end = nullptr;
+  x         = std::strtod(b, &end);
+  if (end == b) { error("bad number in CSV"); }
+  return end;
+}
+#endif
+
+
+/// Format a number so that it can be parsed back without loss.
+///
+/// With C++17, std::to_chars produces the shortest such representation.
+/// Otherwise, snprintf is used with enough digits for a round trip.
+///
+/// @tparam T    Type of number.
+/// @param  buf  Buffer of at least 64 characters.
+/// @param  x    Number.
+/// @return      Number of characters written.
+template <typename T> inline size_t format_number(char *buf, T x) {
+#if __cplusplus >= 201703L && defined(__cpp_lib_to_chars)
+  return std::to_chars(buf, buf + 64, x).ptr - buf;
+#else
+  enum { DIGITS = std::numeric_limits<T>::max_digits10 };
+  if (sizeof(T) > sizeof(double)) {
+    return std::snprintf(buf, 64, "%.*Lg", DIGITS, (long double)(x));
+  }
+  return std::snprintf(buf, 64, "%.*g", DIGITS, double(x));
+#endif
+}
+
+
+/// Pointer past the end of the line that begins at b, or e if there be no
+/// newline.
+/// @param b  Pointer to first character of line.
+/// @param e  Pointer past last character in buffer.
+inline char const *line_end(char const *b, char const *e) {
+  while (b != e && *b != '\n') { ++b; }
+  return b;
+}
+
+
+/// Parse the lines in [b, e) into columns of numbers, and then scale each
+/// column into base-units.
+///
+/// @tparam T     Type of number.
+/// @param  b     Pointer to first character of first line.
+/// @param  e     Pointer past newline of last line.
+/// @param  sf    Scale-factor for each column.
+/// @param  cols  Storage for columns.
+template <typename T>
+void parse_lines(char const *b, char const *e, std::vector<T> const &sf,
+                 std::vector<std::vector<T>> &cols) {
+  size_t const nc = sf.size();
+  while (b != e) {
+    char const *const le = line_end(b, e);
+    char const *      p  = b;
+    while (p != le && (*p == ' ' || *p == '\t' || *p == '\r')) { ++p; }
+    if (p != le) { // Skip blank line.
+      for (size_t c = 0; c < nc; ++c) {
+        T x;
+        p = parse_number(p, le, x);
+        cols[c].push_back(x);
+        while (p != le && (*p == ' ' || *p == '\t' || *p == '\r')) { ++p; }
+        if (c + 1 < nc) {
+          if (p == le || *p != ',') {
+            return error("too few fields in CSV row");
+          }
+          ++p;
+        }
+      }
+      if (p != le) { return error("too many fields in CSV row"); }
+    }
+    b = (le == e ? e : le + 1);
+  }
+  // Bulk conversion to base-units, one column at a time.
+  for (size_t c = 0; c < nc; ++c) {
+    T const      f = sf[c];
+    T *const     x = cols[c].data();
+    size_t const n = cols[c].size();
+    if (f != T(1)) {
+      for (size_t i = 0; i < n; ++i) { x[i] *= f; }
+    }
+  }
+}
+
+
+} // namespace impl
+
+
+/// Parse header of CSV-file, such as "t[s],x[km],F[mN]".
+///
+/// Each unit is resolved once, via parse_unit().  A field without brackets
+/// is dimensionless.
+///
+/// @param line  First line of CSV-file.
+/// @return      Name and unit of each column.
+inline std::vector<csv_field> parse_csv_header(std::string const &line) {
+  std::vector<csv_field> fields;
+  size_t                 b = 0;
+  for (;;) {
+    size_t e = line.find(',', b);
+    if (e == std::string::npos) { e = line.size(); }
+    std::string f = line.substr(b, e - b);
+    while (!f.empty() && (f.back() == '\r' || f.back() == ' ')) {
+      f.pop_back();
+    }
+    while (!f.empty() && f.front() == ' ') { f.erase(0, 1); }
+    csv_field    cf;
+    size_t const lb = f.find('[');
+    if (lb == std::string::npos) {
+      cf.name = f;
+    } else {
+      if (f.back() != ']') { error("expected ']' in CSV header"); }
+      cf.name = f.substr(0, lb);
+      cf.unit = f.substr(lb + 1, f.size() - lb - 2);
+    }
+    cf.u = parse_unit(cf.unit);
+    fields.push_back(cf);
+    if (e == line.size()) { break; }
+    b = e + 1;
+  }
+  return fields;
+}
+
+
+/// Chunked, multithreaded reader of CSV-file whose header is annotated with
+/// units, as in "t[s],x[km],F[mN]".
+///
+/// The header's units are resolved once per file.  Thereafter, the file is
+/// read in chunks of whole lines.  Each chunk is divided among threads, each
+/// of which parses its lines into columns and converts each column in bulk to
+/// base-units.  The columns are then appended, in order, to a basic_table.
+///
+/// @tparam T  Type of number (float, double, etc.).
+template <typename T> class basic_csv_reader {
+  size_t   chunk_;   ///< Number of bytes per chunk.
+  unsigned threads_; ///< Number of threads.
+
+  /// Parse whole lines in [b, e) and append them to table.
+  /// @param b   Pointer to first character of first line.
+  /// @param e   Pointer past newline of last line.
+  /// @param sf  Scale-factor for each column.
+  /// @param t   Table to which rows are appended.
+  void parse(char const *b, char const *e, std::vector<T> const &sf,
+             basic_table<T> &t) const {
+    using cols = std::vector<std::vector<T>>;
+    // Avoid starting a thread for less than a few pages of text.
+    size_t const nt = std::min<size_t>(threads_, (e - b) / 16384 + 1);
+    std::vector<char const *> bnd(nt + 1, e);
+    bnd[0] = b;
+    for (size_t i = 1; i < nt; ++i) {
+      char const *p = b + (e - b) * i / nt;
+      if (p < bnd[i - 1]) { p = bnd[i - 1]; }
+      p      = impl::line_end(p, e);
+      bnd[i] = (p == e ? e : p + 1);
+    }
+    std::vector<cols>        parts(nt, cols(sf.size()));
+    std::vector<std::thread> workers;
+    std::vector<char const *> errors(nt, nullptr);
+    for (size_t i = 0; i < nt; ++i) {
+      auto job = [&, i] {
+#if VNIX_EXCEPTIONS
+        try {
+          impl::parse_lines(bnd[i], bnd[i + 1], sf, parts[i]);
+        } catch (char const *err) { errors[i] = err; }
+#else
+        clear_error();
+        impl::parse_lines(bnd[i], bnd[i + 1], sf, parts[i]);
+        errors[i] = last_error();
+#endif
+      };
+      if (i + 1 < nt) {
+        workers.emplace_back(job);
+      } else {
+        job(); // Use calling thread for last part.
+      }
+    }
+    for (auto &w : workers) { w.join(); }
+    for (auto err : errors) {
+      if (err) {
+        error(err);
+        return;
+      }
+    }
+    for (auto const &p : parts) {
+      typename basic_table<T>::spans s;
+      for (size_t c = 0; c < p.size(); ++c) {
+        s.emplace_back(p[c].data(), p[c].size(), t.schema()[c].d);
+      }
+      t.append(s);
+    }
+  }
+
+public:
+  /// Initialize from size of chunk and number of threads.
+  /// @param chunk    Number of bytes per chunk (by default, 4 MiB).
+  /// @param threads  Number of threads (by default, one per core).
+  basic_csv_reader(size_t   chunk   = size_t(1) << 22,
+                   unsigned threads = std::thread::hardware_concurrency())
+      : chunk_(std::max<size_t>(chunk, 1)),
+        threads_(std::max<unsigned>(threads, 1)) {}
+
+  /// Read whole CSV-file into new table.
+  ///
+  /// This will throw an exception if a unit in the header be unknown or if
+  /// any row be malformed.
+  ///
+  /// @param is  Input stream positioned at header.
+  /// @return    Table whose columns are named and dimensioned by header.
+  basic_table<T> read(std::istream &is) const {
+    std::string header;
+    if (!std::getline(is, header)) { error("missing CSV header"); }
+    auto const               fields = parse_csv_header(header);
+    std::vector<column_spec> schema;
+    std::vector<T>           sf;
+    for (auto const &f : fields) {
+      schema.emplace_back(f.name, f.u.d);
+      sf.push_back(T(f.u.sf));
+    }
+    basic_table<T> t(schema);
+    std::string    buf; // Leftover partial line, then chunk.
+    std::vector<char> blk(chunk_);
+    for (;;) {
+      is.read(blk.data(), blk.size());
+      size_t const got = is.gcount();
+      buf.append(blk.data(), got);
+      bool const   eof  = (got < blk.size());
+      size_t const last = buf.rfind('\n');
+      if (eof) {
+        // Terminate last line so that every line ends in newline.
+        if (!buf.empty() && buf.back() != '\n') { buf.push_back('\n'); }
+        parse(buf.data(), buf.data() + buf.size(), sf, t);
+        break;
+      }
+      if (last != std::string::npos) {
+        parse(buf.data(), buf.data() + last + 1, sf, t);
+        buf.erase(0, last + 1);
+      }
+    }
+    return t;
+  }
+};
+
+
+/// Write table as CSV-file whose header is annotated with units.
+///
+/// Each unit is resolved once and checked once against the dimension of its
+/// column.  Each number is converted from base-units by multiplying by the
+/// reciprocal of the unit's scale-factor.
+///
+/// @tparam T      Type of number in table.
+/// @param  os     Output stream.
+/// @param  t      Table to write.
+/// @param  units  Expression of unit for each column (empty for
+///                dimensionless).
+template <typename T>
+void write_csv(std::ostream &os, basic_table<T> const &t,
+               std::vector<std::string> const &units) {
+  size_t const nc = t.cols();
+  if (units.size() != nc) { error("wrong number of units for CSV"); }
+  std::vector<T> rf(nc); // Reciprocal scale-factor for each column.
+  std::string    line;
+  for (size_t c = 0; c < nc; ++c) {
+    unit_spec const u = parse_unit(units[c]);
+    if (u.d != t.schema()[c].d) { error("incompatible unit for CSV column"); }
+    rf[c] = T(1 / u.sf);
+    if (c) { line += ','; }
+    line += t.schema()[c].name;
+    if (!units[c].empty()) { line += '[' + units[c] + ']'; }
+  }
+  os << line << '\n';
+  std::vector<T const *> cols(nc);
+  for (size_t c = 0; c < nc; ++c) { cols[c] = t.column(c).data(); }
+  char buf[64]; // Buffer for impl::format_number().
+  line.clear();
+  for (size_t r = 0; r < t.rows(); ++r) {
+    for (size_t c = 0; c < nc; ++c) {
+      if (c) { line += ','; }
+      line.append(buf, impl::format_number(buf, cols[c][r] * rf[c]));
+    }
+    line += '\n';
+    if (line.size() > (size_t(1) << 20)) { // Write in large blocks.
+      os << line;
+      line.clear();
+    }
+  }
+  os << line;
+}
+
+
+} // namespace units
+} // namespace vnix
+
+#endif // ndef VNIX_UNITS_CSV_HPP
@@ -0,0 +1,198 @@
+/// @file       vnix/units/dim-partition.hpp
+/// @brief      Definition of vnix::units::basic_dim_partition.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD Three-Clause; see LICENSE.
+
+#ifndef VNIX_UNITS_DIM_PARTITION_HPP
+#define VNIX_UNITS_DIM_PARTITION_HPP
+
+#include <cstdint>                      // for uint32_t, uint64_t
+#include <iterator>                     // for distance
+#include <vector>                       // for vector
+#include <vnix/units/quantity-span.hpp> // for dyndim_span, statdim_span
+
+namespace vnix {
+namespace units {
+
+
+namespace impl {
+
+
+/// Map from dim to consecutive small integer, by open addressing.
+///
+/// Because a stream of quantities often repeats a dimension, the most recent
+/// look-up is cached.
+class dim_ids {
+  enum : uint32_t { EMPTY = ~uint32_t(0) }; ///< Id of empty slot.
+
+  std::vector<dim::word> keys_;  ///< Encoding of dim in each slot.
+  std::vector<uint32_t>  ids_;   ///< Id in each slot, or EMPTY.
+  std::vector<dim>       dims_;  ///< Dim for each id.
+  unsigned               shift_; ///< 64 minus log2 of number of slots.
+  dim                    last_;  ///< Most recently looked-up dim.
+  uint32_t               lid_;   ///< Id of most recently looked-up dim.
+
+  /// Slot holding encoding, or first empty slot at which it would be placed.
+  /// @param w  Encoding of dim.
+  size_t probe(dim::word w) const {
+    // Fibonacci hashing spreads the low bits of the encoding, which hold only
+    // the first exponent, across the whole table.
+    uint64_t const h    = std::hash<dim>()(dim(w)) * 0x9E3779B97F4A7C15ull;
+    size_t const   mask = ids_.size() - 1;
+    for (size_t i = size_t(h >> shift_);; i = (i + 1) & mask) {
+      if (ids_[i] == EMPTY || keys_[i] == w) { return i; }
+    }
+  }
+
+  /// Double number of slots.
+  void grow() {
+    std::vector<dim::word> keys(2 * keys_.size());
+    std::vector<uint32_t>  ids(2 * ids_.size(), EMPTY);
+    keys.swap(keys_);
+    ids.swap(ids_);
+    --shift_;
+    for (size_t i = 0; i < keys.size(); ++i) {
+      if (ids[i] == EMPTY) { continue; }
+      size_t const j = probe(keys[i]);
+      keys_[j]       = keys[i];
+      ids_[j]        = ids[i];
+    }
+  }
+
+public:
+  dim_ids() : keys_(16), ids_(16, EMPTY), shift_(60), lid_(EMPTY) {}
+
+  /// Id of dim, which is assigned, in order of first appearance, if absent.
+  /// @param d  Dimension.
+  uint32_t id(dim d) {
+    if (d == last_ && lid_ != EMPTY) { return lid_; }
+    dim::word const w = d.encode();
+    size_t          i = probe(w);
+    if (ids_[i] == EMPTY) {
+      if (2 * (dims_.size() + 1) > ids_.size()) {
+        grow();
+        i = probe(w);
+      }
+      keys_[i] = w;
+      ids_[i]  = uint32_t(dims_.size());
+      dims_.push_back(d);
+    }
+    last_ = d;
+    return lid_ = ids_[i];
+  }
+
+  /// Dim for each id.
+  std::vector<dim> const &dims() const { return dims_; }
+};
+
+
+} // namespace impl
+
+
+/// Partition of dimensioned quantities, each with its own dimension, into
+/// groups that share a dimension.
+///
+/// The numbers of each group are stored contiguously, so that each group can
+/// be viewed as a dyndim_span or, after a single check of dimension, as a
+/// statdim_span, and passed to a kernel whose dimensions are checked at
+/// compile-time.  The groups are ordered by first appearance in the input,
+/// and within a group the input-order is preserved.
+///
+/// The partition is built as a counting sort: a first pass assigns to each
+/// quantity the id of its dimension and counts the size of each group, and a
+/// second pass scatters each number directly to its final place.
+///
+/// @tparam T  Type of number (float, double, etc.).
+template <typename T> class basic_dim_partition {
+  std::vector<dim>    dims_;  ///< Dimension of each group.
+  std::vector<size_t> offs_;  ///< Offset of each group, plus end.
+  std::vector<T>      nums_;  ///< Numbers, grouped by dimension.
+  std::vector<size_t> index_; ///< Offset in input of each number.
+
+public:
+  /// Partition range of dimensioned quantities.
+  /// @tparam I      Type of forward-iterator over basic_dyndim.
+  /// @param  first  Iterator to first quantity.
+  /// @param  last   Iterator past last quantity.
+  template <typename I> basic_dim_partition(I first, I last) {
+    size_t const          n = std::distance(first, last);
+    impl::dim_ids         ids;
+    std::vector<uint32_t> gid(n);
+    std::vector<size_t>   count;
+    I                     it = first;
+    for (size_t i = 0; i < n; ++i, ++it) {
+      uint32_t const g = ids.id(it->d());
+      if (g == count.size()) { count.push_back(0); }
+      ++count[g];
+      gid[i] = g;
+    }
+    dims_ = ids.dims();
+    offs_.resize(dims_.size() + 1);
+    offs_[0] = 0;
+    for (size_t g = 0; g < dims_.size(); ++g) {
+      offs_[g + 1] = offs_[g] + count[g];
+      count[g]     = offs_[g]; // Now next offset at which to scatter.
+    }
+    nums_.resize(n);
+    index_.resize(n);
+    it = first;
+    for (size_t i = 0; i < n; ++i, ++it) {
+      size_t const j = count[gid[i]]++;
+      nums_[j]       = it->raw_number();
+      index_[j]      = i;
+    }
+  }
+
+  /// Partition vector of dimensioned quantities.
+  /// @param v  Quantities.
+  basic_dim_partition(std::vector<basic_dyndim<T>> const &v)
+      : basic_dim_partition(v.begin(), v.end()) {}
+
+  size_t size() const { return nums_.size(); }   ///< Number of quantities.
+  size_t groups() const { return dims_.size(); } ///< Number of groups.
+
+  /// Dimension of every quantity in group.
+  /// @param g  Offset of group.
+  dim d(size_t g) const { return dims_[g]; }
+
+  /// Offset of group with specified dimension, or groups() if there be none.
+  /// @param d  Dimension.
+  size_t find(dim d) const {
+    for (size_t g = 0; g < dims_.size(); ++g) {
+      if (dims_[g] == d) { return g; }
+    }
+    return dims_.size();
+  }
+
+  /// View of numbers in group.
+  /// @param g  Offset of group.
+  dyndim_span<T const> group(size_t g) const {
+    return {nums_.data() + offs_[g], offs_[g + 1] - offs_[g], dims_[g]};
+  }
+
+  /// Mutable view of numbers in group.
+  /// @param g  Offset of group.
+  dyndim_span<T> group(size_t g) {
+    return {nums_.data() + offs_[g], offs_[g + 1] - offs_[g], dims_[g]};
+  }
+
+  /// View of numbers in group whose dimension is that of quantity-type Q.
+  /// The view is empty if no quantity have the dimension.
+  /// @tparam Q  Type of quantity, such as vnix::units::dbl::force.
+  template <typename Q>
+  statdim_span<Q::d().encode(), T const> group_of() const {
+    size_t const g = find(Q::d());
+    if (g == groups()) { return {nullptr, 0}; }
+    return group(g).template as<Q::d().encode()>();
+  }
+
+  /// Offset in input of each quantity in group.
+  /// @param g  Offset of group.
+  size_t const *index(size_t g) const { return index_.data() + offs_[g]; }
+};
+
+
+} // namespace units
+} // namespace vnix
+
+#endif // ndef VNIX_UNITS_DIM_PARTITION_HPP
@@ -7,9 +7,38 @@
 #define VNIX_UNITS_DIM_HPP
 
 #include <array>                       // for array
+#include <functional>                  // for hash
 #include <vnix/rat.hpp>                // for rational
 #include <vnix/units/dim-base-off.hpp> // for dim_base_off
 
+#ifdef VNIX_UNITS_COUNTERS
+#include <vnix/units/counters.hpp> // for VNIX_UNITS_COUNT
+#elif !defined(VNIX_UNITS_COUNT)
+#define VNIX_UNITS_COUNT(c) ((void)0)
+#define VNIX_UNITS_COUNT_N(c, k) ((void)0)
+#endif
+
+// A constant at namespace-scope has internal linkage, and so a copy in every
+// translation-unit, unless it be inline, which requires C++17.
+#ifdef __cpp_inline_variables
+#define VNIX_UNITS_CONSTANT inline constexpr
+#else
+#define VNIX_UNITS_CONSTANT constexpr
+#endif
+
+// Without optimization, each operator on a dimensioned value is a chain of
+// calls to small functions.  If VNIX_UNITS_DEBUG_INLINE be defined, then each
+// of them is marked always_inline, so that a debug-build (-O0 or -Og) runs
+// closer to the speed of bare numbers, though one can no longer step into an
+// operator in the debugger.
+#if defined(VNIX_UNITS_DEBUG_INLINE) && defined(__GNUC__)
+#define VNIX_UNITS_INLINE __attribute__((always_inline)) inline
+#elif defined(VNIX_UNITS_DEBUG_INLINE) && defined(_MSC_VER)
+#define VNIX_UNITS_INLINE __forceinline
+#else
+#define VNIX_UNITS_INLINE inline
+#endif
+
 namespace vnix {
 namespace units {
 
@@ -18,13 +47,21 @@ namespace units {
 ///
 /// The template-type parameter DBO is of type dim_base_offset, which is
 /// automatically generated from YAML and ERB before the header-only library is
-/// installed.
+/// installed.  DBO determines both the number of base-elements and the number
+/// of bits for each rational exponent, and so the width of the word in which
+/// the exponents are packed, up to 128 bits.
+///
+/// When every exponent in each operand is an integer, addition and
+/// subtraction are performed on all exponents at once, by SIMD-within-a-word
+/// arithmetic on the packed encodings.  Otherwise, or on overflow of a
+/// numerator, each exponent is unpacked and combined separately.
 ///
 /// @tparam DBO  Type of offset of basis-element of dimension.
 template <typename DBO> class basic_dim {
 public:
-  using rat = rational<4, 2>; ///< Type of rational for dimensioned values.
-  using off = DBO;            ///< Type of offset for each base-element.
+  /// Type of rational for dimensioned values.
+  using rat = rational<DBO::nmr_bits, DBO::dnm_bits>;
+  using off = DBO; ///< Type of offset for each base-element.
 
   enum {
     NUM_BASES = DBO::num_offs,        ///< Number of bases for dimension.
@@ -35,7 +72,7 @@ public:
   using word = typename int_types<NUM_BITS>::US;
 
 private:
-  static_assert(NUM_BITS <= 64, "too many bits for bases");
+  static_assert(NUM_BITS <= 128, "too many bits for bases");
   word e_; ///< Storage for exponents.
 
   enum {
@@ -47,7 +84,8 @@ private:
   /// @tparam T  Type that is convertible rat.
   /// @tparam t  Exponent to be encoded.
   template <typename T> constexpr static word encode(T t) {
-    return rat::encode(t) << MAX_SHIFT;
+    constexpr word MASK = exp_mask();
+    return (word(rat::encode(t)) & MASK) << MAX_SHIFT;
   }
 
 #if 1
@@ -61,8 +99,8 @@ private:
     constexpr auto N = sizeof...(us);
     static_assert(N < NUM_BASES, "too many exponents");
     constexpr auto SHIFT = MAX_SHIFT - N * rat::BITS;
-    constexpr word MASK  = bit_range<word>(0, rat::BITS - 1) << SHIFT;
-    word const     e     = rat::encode(t) << SHIFT;
+    constexpr word MASK  = exp_mask() << SHIFT;
+    word const     e     = word(rat::encode(t)) << SHIFT;
     return (e & MASK) | (encode(us...) & ~MASK);
   }
 #endif
@@ -71,13 +109,53 @@ private:
     word es = 0;
     for (uint_fast8_t i = 0; i < NUM_BASES; ++i) {
       auto const SHIFT = i * rat::BITS;
-      word const MASK  = bit_range<word>(0, rat::BITS - 1) << SHIFT;
-      word const e     = rat::encode(a[i]) << SHIFT;
+      word const MASK  = exp_mask() << SHIFT;
+      word const e     = word(rat::encode(a[i])) << SHIFT;
       es |= (e & MASK);
     }
     return es;
   }
 
+  /// Mask for bits of lowest exponent.
+  constexpr static word exp_mask() { return bit_range<word>(0, rat::BITS - 1); }
+
+  /// Word with lowest bit of every exponent set.  Each mask over every
+  /// exponent is a multiple of this, so that no mask needs a loop over bases.
+  constexpr static word low_bits() {
+    return bit_range<word>(0, NUM_BITS - 1) / exp_mask();
+  }
+
+  /// Mask for sign-bit of numerator of every exponent.
+  constexpr static word sign_mask() { return low_bits() << (rat::BITS - 1); }
+
+  /// Mask for bits of denominator of every exponent.
+  constexpr static word dnm_mask() { return low_bits() * rat::DNM_MASK; }
+
+  /// Mask for lowest bit of numerator of every exponent.
+  constexpr static word odd_mask() { return low_bits() << DBO::dnm_bits; }
+
+  /// Add packed integer exponents.
+  /// @param x  Encoding of left-hand exponents, none with denominator.
+  /// @param y  Encoding of right-hand exponents, none with denominator.
+  /// @param z  Encoding of sums.
+  /// @return   False on overflow of any numerator.
+  constexpr static bool packed_add(word x, word y, word &z) {
+    constexpr word H = sign_mask();
+    z = word(word(x & ~H) + word(y & ~H)) ^ ((x ^ y) & H);
+    return (~(x ^ y) & (x ^ z) & H) == 0;
+  }
+
+  /// Subtract packed integer exponents.
+  /// @param x  Encoding of minuends, none with denominator.
+  /// @param y  Encoding of subtrahends, none with denominator.
+  /// @param z  Encoding of differences.
+  /// @return   False on overflow of any numerator.
+  constexpr static bool packed_sub(word x, word y, word &z) {
+    constexpr word H = sign_mask();
+    z = word(word(x | H) - word(y & ~H)) ^ (~(x ^ y) & H);
+    return ((x ^ y) & (x ^ z) & H) == 0;
+  }
+
 public:
   constexpr basic_dim() : e_(0) {}
 
@@ -106,8 +184,8 @@ public:
   /// Rational exponent at specified offset.
   /// @param off  Offset of exponent.
   constexpr rat exp(DBO off) const {
-    constexpr auto mask = bit_range<word>(0, rat::BITS - 1);
-    return rat::decode((e_ >> (off * rat::BITS)) & mask);
+    constexpr auto mask = exp_mask();
+    return rat::decode((e_ >> (unsigned(off) * rat::BITS)) & mask);
   }
 
   /// Rational exponent at specified offset.
@@ -118,9 +196,9 @@ public:
   /// @param off  Offset of exponent.
   /// @param r    Rational exponent.
   constexpr void set(DBO off, rat r) {
-    unsigned const bit_off = off * rat::BITS;
-    word const     expon   = rat::encode(r) << bit_off;
-    auto const     mask    = bit_range<word>(0, rat::BITS - 1) << bit_off;
+    unsigned const bit_off = unsigned(off) * rat::BITS;
+    word const     expon   = word(rat::encode(r)) << bit_off;
+    auto const     mask    = exp_mask() << bit_off;
     e_                     = (e_ & ~mask) | (expon & mask);
   }
 
@@ -131,6 +209,7 @@ public:
   /// @return    New rational exponents.
   template <typename F>
   constexpr basic_dim combine(basic_dim const &d, F f) const {
+    VNIX_UNITS_COUNT(combine);
     basic_dim r(word(0));
     for (auto b : off::array) {
       auto const os = DBO(b);
@@ -144,6 +223,7 @@ public:
   /// @param  f  Unary function operating on rational.
   /// @return    New exponents.
   template <typename F> constexpr basic_dim transform(F f) const {
+    VNIX_UNITS_COUNT(transform);
     basic_dim r(word(0));
     for (auto b : off::array) {
       auto const os = DBO(b);
@@ -192,6 +272,10 @@ public:
   /// @param a  Addends.
   /// @return   Sums.
   constexpr basic_dim operator+(basic_dim const &a) const {
+    if (((e_ | a.e_) & dnm_mask()) == 0) {
+      word z = 0;
+      if (packed_add(e_, a.e_, z)) { return basic_dim(z); }
+    }
     return combine(a, add);
   }
 
@@ -201,6 +285,10 @@ public:
   /// @param s  Subtrahends.
   /// @return   Differences.
   constexpr basic_dim operator-(basic_dim const &s) const {
+    if (((e_ | s.e_) & dnm_mask()) == 0) {
+      word z = 0;
+      if (packed_sub(e_, s.e_, z)) { return basic_dim(z); }
+    }
     return combine(s, sbtrct);
   }
 
@@ -208,26 +296,62 @@ public:
   /// This is called when a physical quantity is raised to a power.
   /// @param f  Factor.
   /// @return   Products.
-  constexpr basic_dim operator*(rat f) const { return transform(mult(f)); }
+  constexpr basic_dim operator*(rat f) const {
+    // Integer power of integer exponents, by repeated packed addition.
+    if (f.d() == 1 && (e_ & dnm_mask()) == 0) {
+      auto const n  = f.n();
+      word       z  = 0;
+      bool       ok = true;
+      for (auto i = (n < 0 ? -n : n); ok && i > 0; --i) {
+        ok = (n < 0 ? packed_sub(z, e_, z) : packed_add(z, e_, z));
+      }
+      if (ok) { return basic_dim(z); }
+    }
+    return transform(mult(f));
+  }
 
   /// Divide exponents by rational factor.
   /// This is called when a physical quantity is raised to a power.
   /// @param f  Factor.
   /// @return   Products.
-  constexpr basic_dim operator/(rat f) const { return transform(divd(f)); }
+  constexpr basic_dim operator/(rat f) const {
+    // Square-root of even exponents, by packed arithmetic shift.
+    if (f == rat(2) && (e_ & (dnm_mask() | odd_mask())) == 0) {
+      constexpr word H = sign_mask();
+      return basic_dim(word((e_ >> 1) & ~H) | (e_ & H));
+    }
+    return transform(divd(f));
+  }
 
   /// Divide exponents by rational factor.
   /// This is called when a physical quantity is raised to a power.
   /// @param f  Factor.
   /// @return   Products.
-  constexpr basic_dim operator/(rat::stype f) const {
-    return transform(divd(f));
+  constexpr basic_dim operator/(typename rat::stype f) const {
+    return *this / rat(f);
   }
 
   constexpr bool operator==(basic_dim const &d) const { return e_ == d.e_; }
 
   constexpr bool operator!=(basic_dim const &d) const { return e_ != d.e_; }
 
+  /// Total ordering by encoding, for use in sorted containers.
+  /// The order is arbitrary but consistent with equality.
+  /// @param d  Right-hand dim.
+  constexpr bool operator<(basic_dim const &d) const { return e_ < d.e_; }
+
+  /// Total ordering by encoding.
+  /// @param d  Right-hand dim.
+  constexpr bool operator>(basic_dim const &d) const { return e_ > d.e_; }
+
+  /// Total ordering by encoding.
+  /// @param d  Right-hand dim.
+  constexpr bool operator<=(basic_dim const &d) const { return e_ <= d.e_; }
+
+  /// Total ordering by encoding.
+  /// @param d  Right-hand dim.
+  constexpr bool operator>=(basic_dim const &d) const { return e_ >= d.e_; }
+
   /// Print to output stream the symbolic contribution from a given unit.
   /// @param s  Output stream.
   /// @param u  Abbreviation for unit.
@@ -260,10 +384,36 @@ public:
 using dim = basic_dim<dim_base_off>;
 
 
-constexpr static dim nul_dim; ///< Null dimension.
+VNIX_UNITS_CONSTANT dim nul_dim; ///< Null dimension.
 
 
 } // namespace units
 } // namespace vnix
 
+
+namespace std {
+
+
+/// Hash of dim, for use in unordered containers.
+///
+/// The encoding is folded into a size_t by exclusive-or, which is the
+/// identity when the encoding fits in a size_t.
+///
+/// @tparam DBO  Type of offset of basis-element of dimension.
+template <typename DBO> struct hash<vnix::units::basic_dim<DBO>> {
+  /// Hash of dim.
+  /// @param d  Dimension.
+  size_t operator()(vnix::units::basic_dim<DBO> const &d) const {
+    auto const w = d.encode();
+    size_t     h = 0;
+    for (unsigned i = 0; i < sizeof(w); i += sizeof(size_t)) {
+      h ^= size_t(w >> (8 * i));
+    }
+    return h;
+  }
+};
+
+
+} // namespace std
+
 #endif // ndef VNIX_DIM_HPP
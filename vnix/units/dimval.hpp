@@ -7,6 +7,7 @@
 #define VNIX_UNITS_DIMVAL_HPP
 
 #include <cmath>                       // for sqrt, pow
+#include <vnix/error.hpp>              // for VNIX_NOEXCEPT
 #include <vnix/units/dim.hpp>          // for dim
 #include <vnix/units/dyndim-base.hpp>  // for dyndim_base
 #include <vnix/units/number.hpp>       // for number
@@ -28,11 +29,13 @@ template <dim::word D, typename T> class basic_statdim;
 /// Specialize this as necessary for matrix, etc.
 /// @tparam T  Numeric type of dimensioned quantity.
 /// @param  v  Numeric value stored in dimensioned quantity.
-template <typename T> constexpr auto invert(T v) { return T(1) / v; }
+template <typename T>
+VNIX_UNITS_INLINE constexpr auto invert(T v) { return T(1) / v; }
 
 /// Specialization of invert() for Eigen::Matrix.
 template <typename S, int R, int C, int OPT, int MR, int MC>
-constexpr auto invert(Eigen::Matrix<S, R, C, OPT, MR, MC> const &m) {
+VNIX_UNITS_INLINE constexpr auto
+invert(Eigen::Matrix<S, R, C, OPT, MR, MC> const &m) {
   return m.inverse();
 }
 
@@ -69,13 +72,35 @@ class dimval : protected number<T>, public B {
 protected:
   /// Initialize dimension, but leave number undefined.
   /// @param d  Dimension.
-  dimval(dim const &d) : B(d) {}
+  dimval(dim const &d) VNIX_NOEXCEPT : B(d) {}
 
   using number<T>::v_; ///< Allow access to numeric value.
 
+  /// Base-dimension of present type, copied from the same type.
+  /// @param b  Base-dimension.
+  /// @return   Copy of base-dimension.
+  VNIX_UNITS_INLINE constexpr static B const &base(B const &b) VNIX_NOEXCEPT {
+    return b;
+  }
+
+  /// Base-dimension of present type, converted from another type.
+  /// This checks at run-time only if the conversion need a check.
+  /// @tparam OB  Other type of base-dimension.
+  /// @param  b   Other base-dimension.
+  /// @return     Converted base-dimension.
+  template <typename OB>
+  VNIX_UNITS_INLINE constexpr static B base(OB const &b) VNIX_NOEXCEPT {
+    return B(b.d());
+  }
+
+  /// Base-dimension of present instance.
+  VNIX_UNITS_INLINE constexpr B const &base() const VNIX_NOEXCEPT {
+    return *this;
+  }
+
 public:
   using B::d;          ///< Allow access to dimension.
-  dimval() : B(d()) {} ///< By default, do not initialize.
+  dimval() VNIX_NOEXCEPT : B(d()) {} ///< By default, do not initialize.
 
   /// Initialize from numeric value and from dimension.
   ///
@@ -85,28 +110,54 @@ public:
   ///
   /// @param v  Numeric value.
   /// @param d  Dimension.
-  constexpr dimval(T const &v, dim const &d) : number<T>(v), B(d) {}
+  VNIX_UNITS_INLINE constexpr dimval(T const &v, dim const &d) VNIX_NOEXCEPT
+      : number<T>(v), B(d) {}
+
+  /// Initialize from numeric value and from base-dimension.
+  ///
+  /// Unlike construction from dim, this does not check the dimension at
+  /// run-time, and so every operator that already knows the result's
+  /// base-dimension uses it.  It is public for the same reason as is the
+  /// constructor from dim.
+  ///
+  /// @param v  Numeric value.
+  /// @param b  Base-dimension.
+  VNIX_UNITS_INLINE constexpr dimval(T const &v, B const &b) VNIX_NOEXCEPT
+      : number<T>(v), B(b) {}
 
   /// Initialize from other dimensioned value.
   /// @tparam OT  Numeric type of other dimensioned value.
   /// @tparam OB  Base-dimension type of other dimensioned value.
   /// @param  v   Reference to other dimensioned value.
   template <typename OT, typename OB>
-  constexpr dimval(dimval<OT, OB> const &v) : number<T>(v.v_), B(v.d()) {}
+  VNIX_UNITS_INLINE constexpr dimval(dimval<OT, OB> const &v) VNIX_NOEXCEPT
+      : number<T>(v.v_), B(base(static_cast<OB const &>(v))) {}
 
   /// Initialize from dimensionless number.
   /// @param n  Number.
-  constexpr dimval(T const &n) : number<T>(n), B(dim()) {}
+  VNIX_UNITS_INLINE constexpr dimval(T const &n) VNIX_NOEXCEPT
+      : number<T>(n), B(dim()) {}
 
   /// Convert to dimensionless number.
-  constexpr T to_number() const {
+  VNIX_UNITS_INLINE constexpr T to_number() const VNIX_NOEXCEPT {
     B::number();
     return v_;
   }
 
+  /// Numeric value in units of the basis, without regard to dimension.
+  ///
+  /// This is intended for bulk kernels (tables, spans, etc.) that check the
+  /// dimension once for many numbers.  Ordinary code should use to_number(),
+  /// which checks that the quantity is dimensionless.
+  VNIX_UNITS_INLINE constexpr T const &raw_number() const VNIX_NOEXCEPT {
+    return v_;
+  }
+
   /// Exponent for base at specified offset.
   /// @param off  Offset.
-  constexpr dim::rat d(dim::off off) const { return B::d()[off]; }
+  VNIX_UNITS_INLINE constexpr dim::rat d(dim::off off) const VNIX_NOEXCEPT {
+    return B::d()[off];
+  }
 
   /// Equality-comparison of two dimensioned values.
   /// This will throw an exception if the dimensions are different.
@@ -115,7 +166,8 @@ public:
   /// @param  v   Reference to other dimensioned value.
   /// @return     True only if this and the other be equal.
   template <typename OT, typename OB>
-  constexpr auto operator==(dimval<OT, OB> const &v) const {
+  VNIX_UNITS_INLINE constexpr auto
+  operator==(dimval<OT, OB> const &v) const VNIX_NOEXCEPT {
     B::comparison(v); // Check for compatibility of units.
     return v_ == v.v_;
   }
@@ -127,7 +179,8 @@ public:
   /// @param  v   Reference to other dimensioned value.
   /// @return     True only if this and the other be unequal.
   template <typename OT, typename OB>
-  constexpr auto operator!=(dimval<OT, OB> const &v) const {
+  VNIX_UNITS_INLINE constexpr auto
+  operator!=(dimval<OT, OB> const &v) const VNIX_NOEXCEPT {
     return !(*this == v);
   }
 
@@ -138,7 +191,8 @@ public:
   /// @param  v   Reference to other dimensioned value.
   /// @return     True only if this be less than the other.
   template <typename OT, typename OB>
-  constexpr auto operator<(dimval<OT, OB> const &v) const {
+  VNIX_UNITS_INLINE constexpr auto
+  operator<(dimval<OT, OB> const &v) const VNIX_NOEXCEPT {
     B::comparison(v); // Check for compatibility of units.
     return v_ < v.v_;
   }
@@ -150,7 +204,8 @@ public:
   /// @param  v   Reference to other dimensioned value.
   /// @return     True only if this be less than or equal to the other.
   template <typename OT, typename OB>
-  constexpr auto operator<=(dimval<OT, OB> const &v) const {
+  VNIX_UNITS_INLINE constexpr auto
+  operator<=(dimval<OT, OB> const &v) const VNIX_NOEXCEPT {
     B::comparison(v); // Check for compatibility of units.
     return v_ <= v.v_;
   }
@@ -162,7 +217,8 @@ public:
   /// @param  v   Reference to other dimensioned value.
   /// @return     True only if this be greater than the other.
   template <typename OT, typename OB>
-  constexpr auto operator>(dimval<OT, OB> const &v) const {
+  VNIX_UNITS_INLINE constexpr auto
+  operator>(dimval<OT, OB> const &v) const VNIX_NOEXCEPT {
     return !(*this <= v);
   }
 
@@ -173,7 +229,8 @@ public:
   /// @param  v   Reference to other dimensioned value.
   /// @return     True only if this be greater than or equal to the other.
   template <typename OT, typename OB>
-  constexpr auto operator>=(dimval<OT, OB> const &v) const {
+  VNIX_UNITS_INLINE constexpr auto
+  operator>=(dimval<OT, OB> const &v) const VNIX_NOEXCEPT {
     return !(*this < v);
   }
 
@@ -183,10 +240,11 @@ public:
   /// @param  v   Addend.
   /// @return     Sum.
   template <typename OT, typename OB>
-  constexpr auto operator+(dimval<OT, OB> const &v) const {
-    auto const sdim = B::sum(v); // Check for compatibility of units.
-    auto       sum  = v_ + v.v_;
-    return dimval<decltype(sum), B>(sum, sdim.d());
+  VNIX_UNITS_INLINE constexpr auto
+  operator+(dimval<OT, OB> const &v) const VNIX_NOEXCEPT {
+    B::sum(v); // Check for compatibility of units.
+    auto sum = v_ + v.v_;
+    return dimval<decltype(sum), B>(sum, base());
   }
 
   /// Difference between two dimensioned values.
@@ -195,10 +253,11 @@ public:
   /// @param  v   Subractor.
   /// @return     Difference.
   template <typename OT, typename OB>
-  constexpr auto operator-(dimval<OT, OB> const &v) const {
-    auto const ddim = B::diff(v); // Check for compatibility of units.
-    auto       diff = v_ - v.v_;
-    return dimval<decltype(diff), B>(diff, ddim.d());
+  VNIX_UNITS_INLINE constexpr auto
+  operator-(dimval<OT, OB> const &v) const VNIX_NOEXCEPT {
+    B::diff(v); // Check for compatibility of units.
+    auto diff = v_ - v.v_;
+    return dimval<decltype(diff), B>(diff, base());
   }
 
   /// Modify present instance by adding in a dimensioned value.
@@ -207,7 +266,8 @@ public:
   /// @param  v   Addend.
   /// @return     Sum.
   template <typename OT, typename OB>
-  constexpr dimval &operator+=(dimval<OT, OB> const &v) {
+  VNIX_UNITS_INLINE constexpr dimval &
+  operator+=(dimval<OT, OB> const &v) VNIX_NOEXCEPT {
     B::sum(v); // Check for compatibility of units.
     v_ += v.v_;
     return *this;
@@ -219,7 +279,8 @@ public:
   /// @param  v   Subtractor.
   /// @return     Difference.
   template <typename OT, typename OB>
-  constexpr dimval &operator-=(dimval<OT, OB> const &v) {
+  VNIX_UNITS_INLINE constexpr dimval &
+  operator-=(dimval<OT, OB> const &v) VNIX_NOEXCEPT {
     B::diff(v); // Check for compatibility of units.
     v_ -= v.v_;
     return *this;
@@ -234,9 +295,9 @@ public:
   /// @param  n   Scale-factor.
   /// @return     Scaled value.
   template <typename OT, otest<OT> = 0>
-  constexpr auto operator*(OT const &n) const {
+  VNIX_UNITS_INLINE constexpr auto operator*(OT const &n) const VNIX_NOEXCEPT {
     auto prod = v_ * n;
-    return dimval<decltype(prod), B>(prod, d());
+    return dimval<decltype(prod), B>(prod, base());
   }
 
   /// Scale dimensioned value.
@@ -249,9 +310,10 @@ public:
   /// @param  v   Original value.
   /// @return     Scaled value.
   template <typename OT, otest<OT> = 0>
-  friend constexpr auto operator*(OT const &n, dimval const &v) {
+  friend VNIX_UNITS_INLINE constexpr auto
+  operator*(OT const &n, dimval const &v) VNIX_NOEXCEPT {
     auto prod = n * v.v_;
-    return dimval<decltype(prod), B>(prod, v.d());
+    return dimval<decltype(prod), B>(prod, v.base());
   }
 
   /// Multiply two dimensioned values.
@@ -260,26 +322,28 @@ public:
   /// @param  v   Factor.
   /// @return     Product.
   template <typename OT, typename OB>
-  constexpr auto operator*(dimval<OT, OB> const &v) const {
+  VNIX_UNITS_INLINE constexpr auto
+  operator*(dimval<OT, OB> const &v) const VNIX_NOEXCEPT {
     auto const pdim = B::prod(v);
     auto       prod = v_ * v.v_;
-    return dimval<decltype(prod), decltype(pdim)>(prod, pdim.d());
+    return dimval<decltype(prod), decltype(pdim)>(prod, pdim);
   }
 
   /// Support element-access in case it be supported by numeric type.
   /// @param off  Offset of element.
-  constexpr auto operator[](size_t off) const {
+  VNIX_UNITS_INLINE constexpr auto operator[](size_t off) const VNIX_NOEXCEPT {
     auto e = v_[off];
-    return dimval<decltype(e), B>(e, d());
+    return dimval<decltype(e), B>(e, base());
   }
 
   /// Support dot-product in case it be supported by numeric type.
   /// @tparam OT  Numeric type of factor.
   /// @param  n   Factor.
   /// @return     Dot-product.
-  template <typename OT, otest<OT> = 0> constexpr auto dot(OT const &n) const {
+  template <typename OT, otest<OT> = 0>
+  VNIX_UNITS_INLINE constexpr auto dot(OT const &n) const VNIX_NOEXCEPT {
     auto prod = v_.dot(n);
-    return dimval<decltype(prod), B>(prod, d());
+    return dimval<decltype(prod), B>(prod, base());
   }
 
   /// Support dot-product in case it be supported by numeric type.
@@ -288,10 +352,11 @@ public:
   /// @param  v   Factor.
   /// @return     Dot-product.
   template <typename OT, typename OB>
-  constexpr auto dot(dimval<OT, OB> const &v) const {
+  VNIX_UNITS_INLINE constexpr auto
+  dot(dimval<OT, OB> const &v) const VNIX_NOEXCEPT {
     auto const pdim = B::prod(v);
     auto       prod = v_.dot(v.v_);
-    return dimval<decltype(prod), decltype(pdim)>(prod, pdim.d());
+    return dimval<decltype(prod), decltype(pdim)>(prod, pdim);
   }
 
   /// Support cross-product in case it be supported by numeric type.
@@ -299,9 +364,9 @@ public:
   /// @param  n   Factor.
   /// @return     Cross-product.
   template <typename OT, otest<OT> = 0>
-  constexpr auto cross(OT const &n) const {
+  VNIX_UNITS_INLINE constexpr auto cross(OT const &n) const VNIX_NOEXCEPT {
     auto prod = v_.cross(n);
-    return dimval<decltype(prod), B>(prod, d());
+    return dimval<decltype(prod), B>(prod, base());
   }
 
   /// Support cross-product in case it be supported by numeric type.
@@ -310,10 +375,11 @@ public:
   /// @param  v   Factor.
   /// @return     Dot-product.
   template <typename OT, typename OB>
-  constexpr auto cross(dimval<OT, OB> const &v) const {
+  VNIX_UNITS_INLINE constexpr auto
+  cross(dimval<OT, OB> const &v) const VNIX_NOEXCEPT {
     auto const pdim = B::prod(v);
     auto       prod = v_.cross(v.v_);
-    return dimval<decltype(prod), decltype(pdim)>(prod, pdim.d());
+    return dimval<decltype(prod), decltype(pdim)>(prod, pdim);
   }
 
   /// Scale dimensioned quantity by dividing by number.
@@ -325,16 +391,17 @@ public:
   /// @param  n   Scale-divisor.
   /// @return     Scaled value.
   template <typename OT, otest<OT> = 0>
-  constexpr auto operator/(OT const &n) const {
+  VNIX_UNITS_INLINE constexpr auto operator/(OT const &n) const VNIX_NOEXCEPT {
     auto quot = v_ / n;
-    return dimval<decltype(quot), B>(quot, d());
+    return dimval<decltype(quot), B>(quot, base());
   }
 
   /// Invert dimensioned value.
   /// @return Reciprocal of dimval.
-  constexpr dimval<T, typename B::recip_basedim> inverse() const {
+  VNIX_UNITS_INLINE constexpr dimval<T, typename B::recip_basedim>
+  inverse() const VNIX_NOEXCEPT {
     auto const br = this->recip();
-    return dimval<T, typename B::recip_basedim>(invert(v_), br.d());
+    return dimval<T, typename B::recip_basedim>(invert(v_), br);
   }
 
   /// Divide two dimensioned values.
@@ -343,10 +410,11 @@ public:
   /// @param  v   Divisor.
   /// @return     Quotient.
   template <typename OT, typename OB>
-  constexpr auto operator/(dimval<OT, OB> const &v) const {
+  VNIX_UNITS_INLINE constexpr auto
+  operator/(dimval<OT, OB> const &v) const VNIX_NOEXCEPT {
     auto const qdim = B::quot(v);
     auto       quot = v_ / v.v_;
-    return dimval<decltype(quot), decltype(qdim)>(v_ / v.v_, qdim.d());
+    return dimval<decltype(quot), decltype(qdim)>(v_ / v.v_, qdim);
   }
 
   /// Modify present instance by multiplying in a dimensionless value.
@@ -358,7 +426,7 @@ public:
   /// @param  v   Dimensionless scale-factor.
   /// @return     Scaled value.
   template <typename OT, otest<OT> = 0>
-  constexpr dimval &operator*=(OT const &v) {
+  VNIX_UNITS_INLINE constexpr dimval &operator*=(OT const &v) VNIX_NOEXCEPT {
     v_ *= v;
     return *this;
   }
@@ -372,7 +440,7 @@ public:
   /// @param  v   Dimensionless scale-divisor.
   /// @return     Scaled value.
   template <typename OT, otest<OT> = 0>
-  constexpr dimval &operator/=(OT const &v) {
+  VNIX_UNITS_INLINE constexpr dimval &operator/=(OT const &v) VNIX_NOEXCEPT {
     v_ /= v;
     return *this;
   }
@@ -381,26 +449,27 @@ public:
   /// @tparam PN  Numerator of power.
   /// @tparam PD  Denominator of power (by default, 1).
   /// @return     Transformed value of different dimension.
-  template <int64_t PN, int64_t PD = 1> constexpr auto power() const {
+  template <int64_t PN, int64_t PD = 1>
+  VNIX_UNITS_INLINE constexpr auto power() const VNIX_NOEXCEPT {
     auto const pdim = B::template pow<PN, PD>();
     auto const powr = pow(v_, PN * 1.0 / PD);
-    return dimval<T, decltype(pdim)>(powr, pdim.d());
+    return dimval<T, decltype(pdim)>(powr, pdim);
   }
 
   /// Raise dimensioned value to rational power.
   /// @param p  Rational power.
   /// @return   Transformed value of different dimension.
-  constexpr auto power(dim::rat p) const {
+  VNIX_UNITS_INLINE constexpr auto power(dim::rat p) const VNIX_NOEXCEPT {
     auto const pdim = B::pow(p);
     auto const powr = pow(v_, p.to_double());
-    return dimval<T, decltype(pdim)>(powr, pdim.d());
+    return dimval<T, decltype(pdim)>(powr, pdim);
   }
 
   /// Square-root of a dimensioned quantity.
-  constexpr auto square_root() const {
+  VNIX_UNITS_INLINE constexpr auto square_root() const VNIX_NOEXCEPT {
     auto const rdim = B::sqrt();
     T const    root = sqrt(v_);
-    return dimval<T, decltype(rdim)>(root, rdim.d());
+    return dimval<T, decltype(rdim)>(root, rdim);
   }
 
   /// Print to to output stream.
@@ -422,7 +491,8 @@ public:
 /// @param  v   Dimensioned quantitity as divisor.
 /// @return     Inverted value.
 template <typename OT, typename T, typename B, otest<OT> = 0>
-constexpr auto operator/(OT const &d, dimval<T, B> const &v) {
+VNIX_UNITS_INLINE constexpr auto
+operator/(OT const &d, dimval<T, B> const &v) VNIX_NOEXCEPT {
   return d * v.inverse();
 }
 
@@ -433,7 +503,7 @@ constexpr auto operator/(OT const &d, dimval<T, B> const &v) {
 /// @param  v  Original dimensioned value.
 /// @return    Transformed value of different dimension.
 template <typename T, typename B, otest<T> = 0>
-constexpr auto sqrt(dimval<T, B> const &v) {
+VNIX_UNITS_INLINE constexpr auto sqrt(dimval<T, B> const &v) VNIX_NOEXCEPT {
   return v.square_root();
 }
 
@@ -445,7 +515,7 @@ constexpr auto sqrt(dimval<T, B> const &v) {
 /// @param  v   Original dimensioned value.
 /// @return     Transformed value of different dimension.
 template <int64_t PN, int64_t PD = 1, typename T, typename B>
-constexpr auto pow(dimval<T, B> const &v) {
+VNIX_UNITS_INLINE constexpr auto pow(dimval<T, B> const &v) VNIX_NOEXCEPT {
   return v.template power<PN, PD>();
 }
 
@@ -457,7 +527,8 @@ constexpr auto pow(dimval<T, B> const &v) {
 /// @param  p  Rational power.
 /// @return    Transformed value of different dimension.
 template <typename T, typename B>
-constexpr auto pow(dimval<T, B> const &v, dim::rat p) {
+VNIX_UNITS_INLINE constexpr auto
+pow(dimval<T, B> const &v, dim::rat p) VNIX_NOEXCEPT {
   return v.power(p);
 }
 
@@ -473,12 +544,14 @@ public:
   /// @tparam OB  Dimension-base of other dimensioned value.
   /// @param  v   Reference to other dimensioned value.
   template <typename OT, typename OB>
-  constexpr basic_dyndim(dimval<OT, OB> const &v)
+  VNIX_UNITS_INLINE constexpr
+  basic_dyndim(dimval<OT, OB> const &v) VNIX_NOEXCEPT
       : dimval<T, dyndim_base>(v) {}
 
   /// Convert from number.
   /// @param v  Number.
-  constexpr basic_dyndim(T v) : dimval<T, dyndim_base>(v, dim()) {}
+  VNIX_UNITS_INLINE constexpr basic_dyndim(T v) VNIX_NOEXCEPT
+      : dimval<T, dyndim_base>(v, dim()) {}
 
   // TBD: dyndim should have a constructor from std::string.
 };
@@ -501,23 +574,26 @@ protected:
 
 public:
   /// By default, initialize dimension, but leave number uninitialized.
-  basic_statdim() : stat<T>(this->d()) {}
+  basic_statdim() VNIX_NOEXCEPT : stat<T>(this->d()) {}
 
   /// Initialize from compatible statdim.
   /// @tparam OT  Type of numeric value.
   /// @param  dv  Compatible statdim.
   template <typename OT>
-  constexpr basic_statdim(stat<OT> dv) : stat<T>(dv.v_, dv.d()) {}
+  VNIX_UNITS_INLINE constexpr basic_statdim(stat<OT> dv) VNIX_NOEXCEPT
+      : stat<T>(dv.v_, dv.base()) {}
 
   /// Initialize from dyndim.
   /// @tparam OT  Numeric type of other dimensioned value.
   /// @param  v   Reference to other dimensioned value.
   template <typename OT>
-  constexpr basic_statdim(dimval<OT, dyndim_base> const &v) : stat<T>(v) {}
+  VNIX_UNITS_INLINE constexpr
+  basic_statdim(dimval<OT, dyndim_base> const &v) VNIX_NOEXCEPT
+      : stat<T>(v) {}
 };
 
 
-constexpr auto nul_code = nul_dim.encode();
+VNIX_UNITS_CONSTANT auto nul_code = nul_dim.encode();
 
 
 /// Specialization of basic_statdim for dimensionless quantity.
@@ -534,19 +610,24 @@ public:
   /// @tparam OT  Type of numeric value.
   /// @param  dv  Compatible statdim.
   template <typename OT>
-  constexpr basic_statdim(stat<OT> dv) : stat<T>(dv.v_, dv.d()) {}
+  VNIX_UNITS_INLINE constexpr basic_statdim(stat<OT> dv) VNIX_NOEXCEPT
+      : stat<T>(dv.v_, dv.base()) {}
 
   /// Initialize from dyndim.
   /// @tparam OT  Numeric type of other dimensioned value.
   /// @param  v   Reference to other dimensioned value.
   template <typename OT>
-  constexpr basic_statdim(dimval<OT, dyndim_base> const &v) : stat<T>(v) {}
+  VNIX_UNITS_INLINE constexpr
+  basic_statdim(dimval<OT, dyndim_base> const &v) VNIX_NOEXCEPT
+      : stat<T>(v) {}
 
   /// Initialize from number.
   /// @param v  Number.
-  constexpr basic_statdim(T v) : stat<T>(v, nul_dim) {}
+  VNIX_UNITS_INLINE constexpr basic_statdim(T v) VNIX_NOEXCEPT
+      : stat<T>(v, nul_dim) {}
 
-  constexpr operator T() const { return v_; } ///< Convert to number.
+  /// Convert to number.
+  VNIX_UNITS_INLINE constexpr operator T() const VNIX_NOEXCEPT { return v_; }
 };
 
 
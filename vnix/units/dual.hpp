@@ -0,0 +1,425 @@
+/// @file       vnix/units/dual.hpp
+/// @brief      Definition of vnix::units::dual and basic_dual_batch.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD Three-Clause; see LICENSE.
+
+#ifndef VNIX_UNITS_DUAL_HPP
+#define VNIX_UNITS_DUAL_HPP
+
+#include <algorithm>                 // for fill
+#include <cmath>                     // for sqrt, pow
+#include <ostream>                   // for ostream
+#include <utility>                   // for declval
+#include <vector>                    // for vector
+#include <vnix/units/dimval.hpp>     // for dimval, basic_dyndim
+#include <vnix/units/soa-kernel.hpp> // for SOA_BLOCK
+
+namespace vnix {
+namespace units {
+
+
+/// Number with derivatives with respect to N independent variables, for
+/// forward-mode automatic differentiation, and for use as the numeric type of
+/// a dimval, as in `dimval<dual<double, 2>, B>`.
+///
+/// Each operation computes the value and, by the chain rule, every
+/// derivative in the same pass.  Derivatives are stored as bare numbers in
+/// units of the basis.  The dimension of the derivative with respect to
+/// variable k is the dimension of the value less that of variable k; see
+/// independent() and derivative().
+///
+/// @tparam T  Type of number (float, double, etc.).
+/// @tparam N  Number of independent variables.
+template <typename T, size_t N> struct dual {
+  T v;    ///< Value.
+  T g[N]; ///< Derivative with respect to each independent variable.
+
+  dual() {} ///< By default, do not initialize.
+
+  /// Initialize constant, whose every derivative is zero.
+  /// @param vv  Value.
+  constexpr dual(T vv) : v(vv), g() {}
+
+  /// Initialize independent variable.
+  /// @param vv  Value.
+  /// @param k   Offset of variable, whose derivative with respect to itself
+  ///            is one.
+  constexpr dual(T vv, size_t k) : v(vv), g() {
+    if (k >= N) { error("offset of variable out of range"); }
+    g[k] = 1;
+  }
+
+  /// Sum.
+  friend dual operator+(dual const &a, dual const &b) {
+    dual r;
+    r.v = a.v + b.v;
+    for (size_t k = 0; k < N; ++k) { r.g[k] = a.g[k] + b.g[k]; }
+    return r;
+  }
+
+  /// Difference.
+  friend dual operator-(dual const &a, dual const &b) {
+    dual r;
+    r.v = a.v - b.v;
+    for (size_t k = 0; k < N; ++k) { r.g[k] = a.g[k] - b.g[k]; }
+    return r;
+  }
+
+  /// Negation.
+  friend dual operator-(dual const &a) { return a * T(-1); }
+
+  /// Product.
+  friend dual operator*(dual const &a, dual const &b) {
+    dual r;
+    r.v = a.v * b.v;
+    for (size_t k = 0; k < N; ++k) { r.g[k] = a.g[k] * b.v + a.v * b.g[k]; }
+    return r;
+  }
+
+  /// Product with constant.
+  friend dual operator*(dual const &a, T c) {
+    dual r;
+    r.v = a.v * c;
+    for (size_t k = 0; k < N; ++k) { r.g[k] = a.g[k] * c; }
+    return r;
+  }
+
+  /// Product with constant.
+  friend dual operator*(T c, dual const &a) { return a * c; }
+
+  /// Quotient.
+  friend dual operator/(dual const &a, dual const &b) {
+    T const rb = 1 / b.v;
+    dual    r;
+    r.v = a.v * rb;
+    for (size_t k = 0; k < N; ++k) { r.g[k] = (a.g[k] - r.v * b.g[k]) * rb; }
+    return r;
+  }
+
+  /// Quotient by constant.
+  friend dual operator/(dual const &a, T c) { return a * (1 / c); }
+
+  /// Add in place.
+  dual &operator+=(dual const &b) { return *this = *this + b; }
+
+  /// Subtract in place.
+  dual &operator-=(dual const &b) { return *this = *this - b; }
+
+  /// Multiply in place.
+  dual &operator*=(dual const &b) { return *this = *this * b; }
+
+  /// Divide in place.
+  dual &operator/=(dual const &b) { return *this = *this / b; }
+
+  /// Equality of value and of every derivative.
+  friend bool operator==(dual const &a, dual const &b) {
+    if (a.v != b.v) { return false; }
+    for (size_t k = 0; k < N; ++k) {
+      if (a.g[k] != b.g[k]) { return false; }
+    }
+    return true;
+  }
+
+  /// Inequality of value or of any derivative.
+  friend bool operator!=(dual const &a, dual const &b) { return !(a == b); }
+
+  /// Comparison of values.
+  friend constexpr bool operator<(dual const &a, dual const &b) {
+    return a.v < b.v;
+  }
+
+  /// Comparison of values.
+  friend constexpr bool operator>(dual const &a, dual const &b) {
+    return a.v > b.v;
+  }
+
+  /// Comparison of values.
+  friend constexpr bool operator<=(dual const &a, dual const &b) {
+    return a.v <= b.v;
+  }
+
+  /// Comparison of values.
+  friend constexpr bool operator>=(dual const &a, dual const &b) {
+    return a.v >= b.v;
+  }
+
+  /// Real power, for dimval::power().
+  /// @param a  Base.
+  /// @param p  Exponent.
+  friend dual pow(dual const &a, double p) {
+    T const dr = T(p * std::pow(a.v, p - 1));
+    dual    r;
+    r.v = T(std::pow(a.v, p));
+    for (size_t k = 0; k < N; ++k) { r.g[k] = dr * a.g[k]; }
+    return r;
+  }
+
+  /// Square-root, for dimval::square_root().
+  /// @param a  Radicand.
+  friend dual sqrt(dual const &a) {
+    dual r;
+    r.v          = std::sqrt(a.v);
+    T const half = T(0.5) / r.v;
+    for (size_t k = 0; k < N; ++k) { r.g[k] = half * a.g[k]; }
+    return r;
+  }
+
+  /// Print as "(v; g0, g1, ...)".
+  friend std::ostream &operator<<(std::ostream &os, dual const &a) {
+    os << "(" << a.v;
+    for (size_t k = 0; k < N; ++k) { os << (k ? ", " : "; ") << a.g[k]; }
+    return os << ")";
+  }
+};
+
+
+/// Independent variable k of N, as quantity whose number is dual.
+/// @tparam N  Number of independent variables.
+/// @tparam T  Type of number.
+/// @tparam B  Base of quantity.
+/// @param  x  Value of variable.
+/// @param  k  Offset of variable.
+template <size_t N, typename T, typename B>
+constexpr dimval<dual<T, N>, B> independent(dimval<T, B> const &x,
+                                            size_t              k) {
+  return dimval<dual<T, N>, B>(dual<T, N>(x.raw_number(), k), x.d());
+}
+
+/// Value of quantity whose number is dual.
+/// @tparam T  Type of number.
+/// @tparam N  Number of independent variables.
+/// @tparam B  Base of quantity.
+/// @param  y  Quantity.
+template <typename T, size_t N, typename B>
+constexpr dimval<T, B> value(dimval<dual<T, N>, B> const &y) {
+  return dimval<T, B>(y.raw_number().v, y.d());
+}
+
+/// Derivative of quantity with respect to independent variable.  The
+/// dimension of the derivative is that of the quotient of the quantity by the
+/// variable, and, if each dimension be known at compile-time, then so is the
+/// dimension of the derivative.
+/// @tparam T   Type of number.
+/// @tparam N   Number of independent variables.
+/// @tparam B   Base of quantity.
+/// @tparam OT  Numeric type of variable.
+/// @tparam OB  Base of variable.
+/// @param  y   Quantity.
+/// @param  x   Variable, or any quantity of the same dimension.
+/// @param  k   Offset of variable.
+template <typename T, size_t N, typename B, typename OT, typename OB>
+constexpr auto derivative(dimval<dual<T, N>, B> const &y,
+                          dimval<OT, OB> const &x, size_t k) {
+  using R = decltype(std::declval<dimval<T, B>>() /
+                     std::declval<dimval<T, OB>>());
+  if (k >= N) { error("offset of variable out of range"); }
+  return R(y.raw_number().g[k], y.d() - x.d());
+}
+
+
+/// Structure of arrays of quantities whose numbers are dual, all of one
+/// dimension, such as one function evaluated at many samples.
+///
+/// The values are stored in one array, and the derivatives with respect to
+/// each variable in another, all in units of the basis, and the dimension of
+/// the values is stored once.  Arithmetic on two batches computes the
+/// dimension of the result once and every value and derivative in loops that
+/// the compiler can vectorize across samples.
+///
+/// @tparam T  Type of number (float, double, etc.).
+/// @tparam N  Number of independent variables.
+template <typename T, size_t N> class basic_dual_batch {
+  size_t         n_; ///< Number of elements.
+  std::vector<T> a_; ///< Values, then derivatives for each variable.
+  dim            d_; ///< Dimension of every value.
+
+public:
+  /// Initialize batch whose every value and derivative is zero.
+  /// @param n   Number of elements.
+  /// @param dd  Dimension of every value.
+  basic_dual_batch(size_t n = 0, dim dd = nul_dim)
+      : n_(n), a_(n * (N + 1)), d_(dd) {}
+
+  size_t   size() const { return n_; }             ///< Number of elements.
+  dim      d() const { return d_; }                ///< Dimension of values.
+  T *      values() { return a_.data(); }          ///< Values.
+  T const *values() const { return a_.data(); }    ///< Values.
+
+  /// Derivatives with respect to variable.
+  /// @param k  Offset of variable.
+  T *derivatives(size_t k) { return a_.data() + (k + 1) * n_; }
+
+  /// Derivatives with respect to variable.
+  /// @param k  Offset of variable.
+  T const *derivatives(size_t k) const { return a_.data() + (k + 1) * n_; }
+
+  /// Make every element independent variable k, whose derivative with
+  /// respect to itself is one.
+  /// @param k  Offset of variable.
+  basic_dual_batch &seed(size_t k) {
+    if (k >= N) { error("offset of variable out of range"); }
+    std::fill(a_.begin() + n_, a_.end(), T(0));
+    std::fill(derivatives(k), derivatives(k) + n_, T(1));
+    return *this;
+  }
+
+  /// Element at offset.
+  /// @param i  Offset of element.
+  basic_dyndim<dual<T, N>> operator[](size_t i) const {
+    dual<T, N> e(a_[i]);
+    for (size_t k = 0; k < N; ++k) { e.g[k] = derivatives(k)[i]; }
+    return dimval<dual<T, N>, dyndim_base>(e, d_);
+  }
+
+  /// Replace element at offset.
+  /// This will throw an exception if the dimensions be different.
+  /// @tparam B  Base of quantity.
+  /// @param  i  Offset of element.
+  /// @param  q  New quantity.
+  template <typename B> void set(size_t i, dimval<dual<T, N>, B> const &q) {
+    if (q.d() != d_) { error("incompatible dimension for batch"); }
+    a_[i] = q.raw_number().v;
+    for (size_t k = 0; k < N; ++k) {
+      derivatives(k)[i] = q.raw_number().g[k];
+    }
+  }
+
+  /// Derivative of element with respect to variable.
+  /// @param i   Offset of element.
+  /// @param k   Offset of variable.
+  /// @param xd  Dimension of variable.
+  basic_dyndim<T> derivative(size_t i, size_t k, dim xd) const {
+    return dimval<T, dyndim_base>(derivatives(k)[i], d_ - xd);
+  }
+
+  /// Add batch of same dimension in place.
+  /// @param b  Addend.
+  basic_dual_batch &operator+=(basic_dual_batch const &b) {
+    if (d_ != b.d_) { error("incompatible dimensions for addition"); }
+    return apply(
+        b, d_, [](T av, T bv) { return av + bv; },
+        [](T, T ag, T, T bg) { return ag + bg; });
+  }
+
+  /// Subtract batch of same dimension in place.
+  /// @param b  Subtrahend.
+  basic_dual_batch &operator-=(basic_dual_batch const &b) {
+    if (d_ != b.d_) { error("incompatible dimensions for subtraction"); }
+    return apply(
+        b, d_, [](T av, T bv) { return av - bv; },
+        [](T, T ag, T, T bg) { return ag - bg; });
+  }
+
+  /// Multiply by batch in place.
+  /// @param b  Factor.
+  basic_dual_batch &operator*=(basic_dual_batch const &b) {
+    return apply(
+        b, d_ + b.d_, [](T av, T bv) { return av * bv; },
+        [](T av, T ag, T bv, T bg) { return ag * bv + av * bg; });
+  }
+
+  /// Divide by batch in place.
+  /// @param b  Divisor.
+  basic_dual_batch &operator/=(basic_dual_batch const &b) {
+    return apply(
+        b, d_ - b.d_, [](T av, T bv) { return av / bv; },
+        [](T av, T ag, T bv, T bg) { return (ag - av / bv * bg) / bv; });
+  }
+
+  /// Sum of two batches.
+  friend basic_dual_batch operator+(basic_dual_batch        a,
+                                    basic_dual_batch const &b) {
+    return a += b;
+  }
+
+  /// Difference of two batches.
+  friend basic_dual_batch operator-(basic_dual_batch        a,
+                                    basic_dual_batch const &b) {
+    return a -= b;
+  }
+
+  /// Product of two batches.
+  friend basic_dual_batch operator*(basic_dual_batch        a,
+                                    basic_dual_batch const &b) {
+    return a *= b;
+  }
+
+  /// Quotient of two batches.
+  friend basic_dual_batch operator/(basic_dual_batch        a,
+                                    basic_dual_batch const &b) {
+    return a /= b;
+  }
+
+  /// Rational power of every element.
+  /// @param a  Batch.
+  /// @param p  Exponent.
+  friend basic_dual_batch pow(basic_dual_batch a, dim::rat p) {
+    T const pd = T(p.to_double());
+    return a.apply(
+        a, a.d_ * p, [pd](T av, T) { return std::pow(av, pd); },
+        [pd](T av, T ag, T, T) { return pd * std::pow(av, pd - 1) * ag; });
+  }
+
+  /// Square-root of every element.
+  /// @param a  Batch.
+  friend basic_dual_batch sqrt(basic_dual_batch a) {
+    return a.apply(
+        a, a.d_ / dim::rat(2), [](T av, T) { return std::sqrt(av); },
+        [](T av, T ag, T, T) { return T(0.5) * ag / std::sqrt(av); });
+  }
+
+private:
+  /// Apply operation, element by element, to this batch and to other batch
+  /// of same size, and replace this batch by result.  Each block of samples
+  /// is copied into local arrays, whose loops have a fixed count, and every
+  /// derivative in the block is computed before the value is overwritten.
+  /// @tparam FV  Type of function(av, bv) returning value.
+  /// @tparam FG  Type of function(av, ag, bv, bg) returning derivative.
+  /// @param  b   Other batch, which may be this batch.
+  /// @param  dd  Dimension of result.
+  /// @param  fv  Value of result.
+  /// @param  fg  Derivative of result.
+  template <typename FV, typename FG>
+  basic_dual_batch &apply(basic_dual_batch const &b, dim dd, FV fv, FG fg) {
+    if (n_ != b.n_) { error("batches of different size"); }
+    size_t const B = impl::SOA_BLOCK;
+    T            av[B], bv[B], ag[B], bg[B];
+    for (size_t j = 0; j < n_; j += B) {
+      size_t const m = (n_ - j < B ? n_ - j : B);
+      for (size_t i = 0; i < m; ++i) {
+        av[i] = a_[j + i];
+        bv[i] = b.a_[j + i];
+      }
+      for (size_t i = m; i < B; ++i) {
+        av[i] = av[0];
+        bv[i] = bv[0];
+      }
+      for (size_t k = 0; k < N; ++k) {
+        T *const       oa = derivatives(k) + j;
+        T const *const ob = b.derivatives(k) + j;
+        for (size_t i = 0; i < m; ++i) {
+          ag[i] = oa[i];
+          bg[i] = ob[i];
+        }
+        for (size_t i = m; i < B; ++i) {
+          ag[i] = ag[0];
+          bg[i] = bg[0];
+        }
+        for (size_t i = 0; i < B; ++i) {
+          ag[i] = fg(av[i], ag[i], bv[i], bg[i]);
+        }
+        for (size_t i = 0; i < m; ++i) { oa[i] = ag[i]; }
+      }
+      for (size_t i = 0; i < B; ++i) { av[i] = fv(av[i], bv[i]); }
+      for (size_t i = 0; i < m; ++i) { a_[j + i] = av[i]; }
+    }
+    d_ = dd;
+    return *this;
+  }
+};
+
+
+} // namespace units
+} // namespace vnix
+
+#endif // ndef VNIX_UNITS_DUAL_HPP
@@ -26,30 +26,47 @@ class dyndim_base {
 
 public:
   /// Initialize from exponents representing dimension.
-  constexpr dyndim_base(dim dd) : d_(dd) {}
+  VNIX_UNITS_INLINE constexpr dyndim_base(dim dd) : d_(dd) {}
 
   /// Exponent for each unit in dimensioned quantity.  This is not static
   /// because it needs to be consistent with signature of dyndim.
-  constexpr dim d() const { return d_; }
+  VNIX_UNITS_INLINE constexpr dim d() const { return d_; }
 
   /// Throw if dimension be non-null.
-  constexpr void number() const {
-    if (d() != nul_dim) { throw "dimensioned quantity is not a number"; }
+  VNIX_UNITS_INLINE constexpr void number() const {
+    VNIX_UNITS_COUNT(check);
+    if (d() != nul_dim) {
+      VNIX_UNITS_COUNT(mismatch);
+      VNIX_UNITS_COUNT(throws);
+      error("dimensioned quantity is not a number");
+    }
   }
 
   /// Test for comparison of dimensioned values.
   /// @tparam B  dyndim_base or statdim_base.
   /// @param  b  Dimension of right side.
-  template <typename B> constexpr void comparison(B const &b) const {
-    if (d_ != b.d()) { throw "incompatible dimensions for comparison"; }
+  template <typename B>
+  VNIX_UNITS_INLINE constexpr void comparison(B const &b) const {
+    VNIX_UNITS_COUNT(check);
+    if (d_ != b.d()) {
+      VNIX_UNITS_COUNT(mismatch);
+      VNIX_UNITS_COUNT(throws);
+      error("incompatible dimensions for comparison");
+    }
   }
 
   /// Dimension for sum of dimensioned values.
   /// @tparam B  dyndim_base or statdim_base.
   /// @param  b  Dimension of addend.
   /// @return    Dimension of sum.
-  template <typename B> constexpr dyndim_base sum(B const &b) const {
-    if (d_ != b.d()) { throw "incompatible dimensions for addition"; }
+  template <typename B>
+  VNIX_UNITS_INLINE constexpr dyndim_base sum(B const &b) const {
+    VNIX_UNITS_COUNT(check);
+    if (d_ != b.d()) {
+      VNIX_UNITS_COUNT(mismatch);
+      VNIX_UNITS_COUNT(throws);
+      error("incompatible dimensions for addition");
+    }
     return d_;
   }
 
@@ -57,8 +74,14 @@ public:
   /// @tparam B  dyndim_base or statdim_base.
   /// @param  b  Dimension of subtractor.
   /// @return    Dimension of difference.
-  template <typename B> constexpr dyndim_base diff(B const &b) const {
-    if (d_ != b.d()) { throw "incompatible dimensions for subtraction"; }
+  template <typename B>
+  VNIX_UNITS_INLINE constexpr dyndim_base diff(B const &b) const {
+    VNIX_UNITS_COUNT(check);
+    if (d_ != b.d()) {
+      VNIX_UNITS_COUNT(mismatch);
+      VNIX_UNITS_COUNT(throws);
+      error("incompatible dimensions for subtraction");
+    }
     return d_;
   }
 
@@ -66,7 +89,8 @@ public:
   /// @tparam B  dyndim_base or statdim_base.
   /// @param  b  Dimension of factor.
   /// @return    Dimension of product.
-  template <typename B> constexpr dyndim_base prod(B const &b) const {
+  template <typename B>
+  VNIX_UNITS_INLINE constexpr dyndim_base prod(B const &b) const {
     return d_ + b.d();
   }
 
@@ -74,7 +98,8 @@ public:
   /// @tparam B  dyndim_base or statdim_base.
   /// @param  b  Dimension of divisor.
   /// @return    Dimension of quotient.
-  template <typename B> constexpr dyndim_base quot(B const &b) const {
+  template <typename B>
+  VNIX_UNITS_INLINE constexpr dyndim_base quot(B const &b) const {
     return d_ - b.d();
   }
 
@@ -83,24 +108,34 @@ public:
 
   /// Dimension for reciprocal of dimensioned value.
   /// @return  Dimension of reciprocal.
-  constexpr recip_basedim recip() const { return nul_dim - d_; }
+  VNIX_UNITS_INLINE constexpr recip_basedim recip() const {
+    return nul_dim - d_;
+  }
 
   /// Dimension for rational power of dimensioned value.
   /// @tparam PN  Numerator   of power.
   /// @tparam PD  Denominator of power.
   /// @return     Dimension   of result.
-  template <int64_t PN, int64_t PD = 1> constexpr dyndim_base pow() const {
+  template <int64_t PN, int64_t PD = 1>
+  VNIX_UNITS_INLINE constexpr dyndim_base pow() const {
+    VNIX_UNITS_COUNT(power);
     return d_ * dim::rat(PN, PD);
   }
 
   /// Dimension for rational power of dimensioned value.
   /// @param  p  Rational power.
   /// @return    Dimension of result.
-  constexpr dyndim_base pow(dim::rat p) const { return d_ * p; }
+  VNIX_UNITS_INLINE constexpr dyndim_base pow(dim::rat p) const {
+    VNIX_UNITS_COUNT(power);
+    return d_ * p;
+  }
 
   /// Dimension for square-root of dimensioned value.
   /// @return  Dimension of square-root.
-  constexpr dyndim_base sqrt() const { return d_ / dim::rat(2); }
+  VNIX_UNITS_INLINE constexpr dyndim_base sqrt() const {
+    VNIX_UNITS_COUNT(sqrt);
+    return d_ / dim::rat(2);
+  }
 };
 
 
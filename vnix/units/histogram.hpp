@@ -0,0 +1,256 @@
+/// @file       vnix/units/histogram.hpp
+/// @brief      Definition of vnix::units::basic_histogram.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD Three-Clause; see LICENSE.
+
+#ifndef VNIX_UNITS_HISTOGRAM_HPP
+#define VNIX_UNITS_HISTOGRAM_HPP
+
+#include <cstdint>                      // for uint32_t, uint64_t
+#include <thread>                       // for thread
+#include <type_traits>                  // for decay_t
+#include <utility>                      // for declval
+#include <vector>                       // for vector
+#include <vnix/units/quantity-span.hpp> // for statdim_span, dyndim_span
+
+namespace vnix {
+namespace units {
+
+
+/// Histogram of quantities whose dimension is known at compile-time.
+///
+/// The bins are either uniform, between a lower and an upper edge, or
+/// arbitrary, between ascending edges.  Each bin includes its lower edge and
+/// excludes its upper edge.  A quantity below the lowest edge is counted as
+/// underflow; a quantity at or above the highest edge, or NaN, is counted as
+/// overflow.
+///
+/// Dimensions are enforced when the edges are defined.  Filling from a span
+/// then works on the bare numbers: a block of bin-indices is computed by a
+/// branch-free loop that the compiler can vectorize, and then the counts are
+/// incremented.  Filling by multiple threads uses a sub-histogram for each
+/// thread, and the sub-histograms are summed at the end.
+///
+/// @tparam D  Encoding of dimension of each quantity.
+/// @tparam T  Type of number (float, double, etc.).
+template <dim::word D, typename T> class basic_histogram {
+public:
+  using quantity = basic_statdim<D, T>; ///< Type of each edge and quantity.
+
+private:
+  enum { BLOCK = 256 }; ///< Number of indices computed at once.
+
+  std::vector<T>        edges_;   ///< Edges, in units of the basis.
+  T                     lo_;      ///< Lowest edge.
+  T                     inv_;     ///< Inverse of width of uniform bin.
+  bool                  uniform_; ///< True if bins be uniform.
+  std::vector<uint64_t> counts_;  ///< Underflow, each bin, and overflow.
+
+  /// Compute slot (0 for underflow, bins() + 1 for overflow) for each of
+  /// BLOCK numbers when bins are uniform.  The fixed count lets the compiler
+  /// vectorize the loop even at -O2.
+  /// @param x    Pointer to first number.
+  /// @param idx  Pointer to first slot.
+  void uniform_slots(T const *x, uint32_t *idx) const {
+    T const lo = lo_, inv = inv_, nb = T(bins());
+    for (size_t i = 0; i < BLOCK; ++i) {
+      idx[i] = uniform_slot(x[i], lo, inv, nb);
+    }
+  }
+
+  /// Slot for number when bins are uniform.
+  /// @param x    Number.
+  /// @param lo   Lowest edge.
+  /// @param inv  Inverse of width of bin.
+  /// @param nb   Number of bins.
+  static uint32_t uniform_slot(T x, T lo, T inv, T nb) {
+    T f = (x - lo) * inv;
+    f   = (f < nb ? f : nb); // NaN becomes nb.
+    f   = (f >= 0 ? f : -1); // Below lowest edge becomes -1.
+    return uint32_t(int32_t(f) + 1);
+  }
+
+  /// Compute slot for each of BLOCK numbers when bins are arbitrary, by
+  /// binary search with a fixed number of iterations and no branch.
+  /// @param x    Pointer to first number.
+  /// @param idx  Pointer to first slot.
+  void edge_slots(T const *x, uint32_t *idx) const {
+    T const *const e  = edges_.data();
+    size_t const   ne = edges_.size();
+    for (size_t i = 0; i < BLOCK; ++i) { idx[i] = edge_slot(x[i], e, ne); }
+  }
+
+  /// Slot for number when bins are arbitrary.
+  /// @param v   Number.
+  /// @param e   Pointer to first edge.
+  /// @param ne  Number of edges.
+  /// @return    Number of edges not greater than v, with NaN above every edge.
+  static uint32_t edge_slot(T v, T const *e, size_t ne) {
+    size_t base = 0;
+    for (size_t m = ne; m > 1; m -= m / 2) {
+      base = (!(v < e[base + m / 2]) ? base + m / 2 : base);
+    }
+    return uint32_t(base + !(v < e[base]));
+  }
+
+  /// Count numbers into slots.
+  /// @param x  Pointer to first number.
+  /// @param n  Number of numbers.
+  /// @param c  Pointer to first of bins() + 2 counts.
+  void count(T const *x, size_t n, uint64_t *c) const {
+    uint32_t idx[BLOCK];
+    T        tail[BLOCK]; // Partial block, padded.
+    for (size_t b = 0; b < n; b += BLOCK) {
+      size_t const m = (n - b < BLOCK ? n - b : size_t(BLOCK));
+      T const *    p = x + b;
+      if (m < BLOCK) {
+        for (size_t i = 0; i < BLOCK; ++i) { tail[i] = (i < m ? p[i] : lo_); }
+        p = tail;
+      }
+      if (uniform_) {
+        uniform_slots(p, idx);
+      } else {
+        edge_slots(p, idx);
+      }
+      for (size_t i = 0; i < m; ++i) { ++c[idx[i]]; }
+    }
+  }
+
+  /// Quantity from number in units of the basis.
+  /// @param x  Number.
+  static quantity q(T x) { return dimval<T, statdim_base<D>>(x, dim(D)); }
+
+public:
+  /// Initialize uniform bins.
+  /// This will throw an exception if hi be not greater than lo.
+  /// @param lo    Lower edge of lowest bin.
+  /// @param hi    Upper edge of highest bin.
+  /// @param bins  Number of bins.
+  basic_histogram(quantity const &lo, quantity const &hi, size_t bins)
+      : edges_(bins + 1), lo_(lo.raw_number()), uniform_(true),
+        counts_(bins + 2) {
+    T const w = (hi.raw_number() - lo_) / T(bins);
+    if (bins == 0 || !(w > 0)) { error("illegal bins for histogram"); }
+    inv_ = T(1) / w;
+    for (size_t i = 0; i <= bins; ++i) { edges_[i] = lo_ + i * w; }
+  }
+
+  /// Initialize arbitrary bins.
+  /// This will throw an exception if the edges be not strictly ascending.
+  /// @param edges  Ascending edges; one more than number of bins.
+  explicit basic_histogram(std::vector<quantity> const &edges)
+      : edges_(edges.size()), uniform_(false), counts_(edges.size() + 1) {
+    if (edges.size() < 2) { error("illegal bins for histogram"); }
+    for (size_t i = 0; i < edges.size(); ++i) {
+      edges_[i] = edges[i].raw_number();
+      if (i && !(edges_[i - 1] < edges_[i])) {
+        error("edges of histogram not ascending");
+      }
+    }
+    lo_  = edges_[0];
+    inv_ = 0;
+  }
+
+  /// Initialize arbitrary bins from quantities of another type, such as
+  /// vnix::units::dbl::speed.
+  /// This will throw an exception if the dimension be incompatible or if the
+  /// edges be not strictly ascending.
+  /// @tparam Q      Type of each edge.
+  /// @param  edges  Ascending edges; one more than number of bins.
+  template <typename Q>
+  explicit basic_histogram(std::vector<Q> const &edges)
+      : basic_histogram(std::vector<quantity>(edges.begin(), edges.end())) {}
+
+  size_t bins() const { return edges_.size() - 1; } ///< Number of bins.
+  bool   uniform() const { return uniform_; } ///< True if bins be uniform.
+
+  /// Edge at specified offset; edge(b) and edge(b + 1) bound bin b.
+  /// @param i  Offset of edge.
+  quantity edge(size_t i) const { return q(edges_[i]); }
+
+  /// Number of quantities in bin.
+  /// @param b  Offset of bin.
+  uint64_t count(size_t b) const { return counts_[b + 1]; }
+
+  /// Number of quantities below lowest edge.
+  uint64_t underflow() const { return counts_.front(); }
+
+  /// Number of quantities at or above highest edge, or NaN.
+  uint64_t overflow() const { return counts_.back(); }
+
+  /// Number of quantities counted, including underflow and overflow.
+  uint64_t total() const {
+    uint64_t t = 0;
+    for (auto c : counts_) { t += c; }
+    return t;
+  }
+
+  /// Count one quantity.
+  /// @param v  Quantity.
+  void add(quantity const &v) {
+    T const x = v.raw_number();
+    ++counts_[uniform_ ? uniform_slot(x, lo_, inv_, T(bins()))
+                       : edge_slot(x, edges_.data(), edges_.size())];
+  }
+
+  /// Count every quantity in span.
+  /// @param s        Span.
+  /// @param threads  Number of threads.
+  void fill(statdim_span<D, T const> const &s, unsigned threads = 1) {
+    size_t const n = s.size();
+    if (threads < 2 || n < threads * size_t(BLOCK)) {
+      return count(s.data(), n, counts_.data());
+    }
+    std::vector<std::vector<uint64_t>> sub(threads);
+    std::vector<std::thread>           pool;
+    size_t const                       chunk = (n + threads - 1) / threads;
+    for (unsigned t = 0; t < threads; ++t) {
+      size_t const b = t * chunk;
+      size_t const m = (b < n ? (n - b < chunk ? n - b : chunk) : 0);
+      sub[t].resize(counts_.size());
+      pool.emplace_back([this, &s, &sub, t, b, m] {
+        count(s.data() + b, m, sub[t].data());
+      });
+    }
+    for (auto &t : pool) { t.join(); }
+    for (auto const &c : sub) {
+      for (size_t i = 0; i < c.size(); ++i) { counts_[i] += c[i]; }
+    }
+  }
+
+  /// Count every quantity in span whose dimension is known at run-time.
+  /// This will throw an exception if the dimension be incompatible.
+  /// @tparam OT       Type of number in span (possibly const).
+  /// @param  s        Span.
+  /// @param  threads  Number of threads.
+  template <typename OT>
+  void fill(dyndim_span<OT> const &s, unsigned threads = 1) {
+    fill(s.template as<D>(), threads);
+  }
+
+  /// Add counts of other histogram with identical edges.
+  /// This will throw an exception if the edges differ.
+  /// @param h  Other histogram.
+  void merge(basic_histogram const &h) {
+    if (h.edges_ != edges_) { error("incompatible histograms"); }
+    for (size_t i = 0; i < counts_.size(); ++i) { counts_[i] += h.counts_[i]; }
+  }
+
+  /// Reset every count to zero.
+  void clear() {
+    for (auto &c : counts_) { c = 0; }
+  }
+};
+
+
+/// Histogram of quantities of type Q, such as vnix::units::dbl::speed.
+/// @tparam Q  Type of quantity.
+template <typename Q>
+using histogram = basic_histogram<
+    Q::d().encode(), std::decay_t<decltype(std::declval<Q>().raw_number())>>;
+
+
+} // namespace units
+} // namespace vnix
+
+#endif // ndef VNIX_UNITS_HISTOGRAM_HPP
@@ -0,0 +1,431 @@
+/// @file       vnix/units/interp.hpp
+/// @brief      Definition of vnix::units::basic_interp and basic_interp2.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD Three-Clause; see LICENSE.
+
+#ifndef VNIX_UNITS_INTERP_HPP
+#define VNIX_UNITS_INTERP_HPP
+
+#include <cmath>                        // for sqrt, abs
+#include <cstdint>                      // for int64_t
+#include <limits>                       // for numeric_limits
+#include <type_traits>                  // for decay_t
+#include <utility>                      // for declval, move
+#include <vector>                       // for vector
+#include <vnix/units/quantity-span.hpp> // for statdim_span, dyndim_span
+
+namespace vnix {
+namespace units {
+
+
+/// Method of interpolation for basic_interp.
+enum class interp_method {
+  linear,        ///< Piecewise-linear.
+  monotone_cubic ///< Fritsch-Carlson monotone piecewise-cubic Hermite.
+};
+
+
+namespace impl {
+
+
+/// Ascending abscissae of interpolation-table, with fast search for the
+/// interval that brackets a number.
+///
+/// When the abscissae are uniformly spaced, the interval is computed
+/// directly.  Otherwise, it is found by a binary search with a fixed number
+/// of iterations and no branch.
+///
+/// @tparam T  Type of number.
+template <typename T> class interp_axis {
+  std::vector<T> x_;       ///< Abscissae.
+  std::vector<T> inv_;     ///< Inverse of width of each interval.
+  T              inv_dx_;  ///< Inverse of width, or zero if not uniform.
+  T              last_;    ///< Offset of last interval, as number.
+
+public:
+  /// Initialize from ascending abscissae.
+  /// This will throw an exception if there be fewer than two abscissae, or if
+  /// they be not strictly ascending.
+  /// @param x  Abscissae, in units of the basis.
+  explicit interp_axis(std::vector<T> x) : x_(std::move(x)), inv_dx_(0) {
+    size_t const n = x_.size();
+    if (n < 2) { error("too few points for interpolation"); }
+    inv_.resize(n - 1);
+    for (size_t i = 0; i + 1 < n; ++i) {
+      if (!(x_[i] < x_[i + 1])) { error("abscissae not ascending"); }
+      inv_[i] = T(1) / (x_[i + 1] - x_[i]);
+    }
+    T const dx  = (x_[n - 1] - x_[0]) / T(n - 1);
+    T const tol = 64 * std::numeric_limits<T>::epsilon() * (x_[n - 1] - x_[0]);
+    bool    uni = true;
+    for (size_t i = 1; i + 1 < n; ++i) {
+      if (std::abs(x_[i] - (x_[0] + T(i) * dx)) > tol) { uni = false; }
+    }
+    if (uni) { inv_dx_ = T(1) / dx; }
+    last_ = T(n - 2);
+  }
+
+  size_t size() const { return x_.size(); }          ///< Number of points.
+  T      operator[](size_t i) const { return x_[i]; } ///< Abscissa.
+  T      inv(size_t i) const { return inv_[i]; }      ///< Inverse of width.
+  bool   uniform() const { return inv_dx_ != 0; }     ///< True if uniform.
+  T      front() const { return x_.front(); }         ///< Lowest abscissa.
+  T      back() const { return x_.back(); }           ///< Highest abscissa.
+
+  /// Offset of interval that brackets number.  A number outside the table is
+  /// bracketed by the nearest interval, and NaN by the last interval.
+  /// @param v  Number.
+  size_t bracket(T v) const {
+    if (inv_dx_ != 0) {
+      T f = (v - x_[0]) * inv_dx_;
+      f   = (f < last_ ? f : last_); // NaN becomes last_.
+      f   = (f > 0 ? f : 0);
+      return size_t(f);
+    }
+    T const *const x    = x_.data();
+    size_t         base = 0;
+    for (size_t m = x_.size() - 1; m > 1; m -= m / 2) {
+      base = (!(v < x[base + m / 2]) ? base + m / 2 : base);
+    }
+    return base;
+  }
+
+  /// Compute offset of bracketing interval for each of BLOCK numbers.  The
+  /// fixed count lets the compiler vectorize the loop even at -O2 when the
+  /// abscissae are uniform.
+  /// @tparam BLOCK  Number of numbers.
+  /// @param  v      Pointer to first number.
+  /// @param  idx    Pointer to first offset.
+  template <size_t BLOCK> void brackets(T const *v, uint32_t *idx) const {
+    if (inv_dx_ != 0) {
+      T const x0 = x_[0], inv = inv_dx_, last = last_;
+      for (size_t i = 0; i < BLOCK; ++i) {
+        T f    = (v[i] - x0) * inv;
+        f      = (f < last ? f : last);
+        f      = (f > 0 ? f : 0);
+        idx[i] = uint32_t(int32_t(f));
+      }
+    } else {
+      for (size_t i = 0; i < BLOCK; ++i) { idx[i] = uint32_t(bracket(v[i])); }
+    }
+  }
+};
+
+
+/// Clamp number to range, preserving NaN.
+/// @tparam T   Type of number.
+/// @param  v   Number.
+/// @param  lo  Lower limit.
+/// @param  hi  Upper limit.
+template <typename T> T clamp(T v, T lo, T hi) {
+  v = (v > hi ? hi : v);
+  return (v < lo ? lo : v);
+}
+
+
+} // namespace impl
+
+
+/// Table of ordinate against abscissa, each a quantity with dimension known
+/// at compile-time, such as pressure against altitude.
+///
+/// The dimensions are enforced when the table is built.  Each interval
+/// stores its cubic polynomial (linear when the method be linear)
+/// contiguously, so that an evaluation reads the abscissae for the search and
+/// then a single record.  Evaluation outside the table clamps the abscissa to
+/// the nearest end.
+///
+/// @tparam DX  Encoding of dimension of abscissa.
+/// @tparam DY  Encoding of dimension of ordinate.
+/// @tparam T   Type of number (float, double, etc.).
+template <dim::word DX, dim::word DY, typename T> class basic_interp {
+public:
+  using abscissa = basic_statdim<DX, T>; ///< Type of abscissa.
+  using ordinate = basic_statdim<DY, T>; ///< Type of ordinate.
+
+private:
+  /// Coefficients of polynomial for interval, in powers of distance from
+  /// lower abscissa of interval.
+  struct poly {
+    T c[4]; ///< Coefficients.
+  };
+
+  enum { BLOCK = 256 }; ///< Number of intervals found at once.
+
+  impl::interp_axis<T> ax_;  ///< Abscissae.
+  std::vector<poly>    p_;   ///< Polynomial for each interval.
+  bool                 cub_; ///< True if cubic.
+
+  /// Raw numbers of quantities.
+  /// @tparam Q  Type of quantity.
+  /// @param  v  Quantities.
+  template <typename Q> static std::vector<T> raw(std::vector<Q> const &v) {
+    std::vector<T> r(v.size());
+    for (size_t i = 0; i < v.size(); ++i) { r[i] = v[i].raw_number(); }
+    return r;
+  }
+
+  /// Compute polynomial for each interval.
+  /// @param y  Ordinates, in units of the basis.
+  void fit(std::vector<T> const &y) {
+    size_t const n = ax_.size();
+    if (y.size() != n) {
+      error("different numbers of abscissae and ordinates");
+    }
+    std::vector<T> s(n - 1); // Secant of each interval.
+    for (size_t i = 0; i + 1 < n; ++i) {
+      s[i] = (y[i + 1] - y[i]) * ax_.inv(i);
+    }
+    std::vector<T> m(n); // Tangent at each point.
+    m[0]     = s[0];
+    m[n - 1] = s[n - 2];
+    for (size_t i = 1; i + 1 < n; ++i) {
+      m[i] = (s[i - 1] * s[i] > 0 ? (s[i - 1] + s[i]) / 2 : T(0));
+    }
+    // Fritsch-Carlson limit on tangents preserves monotonicity.
+    for (size_t i = 0; i + 1 < n; ++i) {
+      if (s[i] == 0) {
+        m[i] = m[i + 1] = 0;
+        continue;
+      }
+      T const a = m[i] / s[i], b = m[i + 1] / s[i], r = a * a + b * b;
+      if (r > 9) {
+        T const t = 3 / std::sqrt(r);
+        m[i]      = t * a * s[i];
+        m[i + 1]  = t * b * s[i];
+      }
+    }
+    p_.resize(n - 1);
+    for (size_t i = 0; i + 1 < n; ++i) {
+      T const ih = ax_.inv(i);
+      if (cub_) {
+        p_[i] = {{y[i], m[i], (3 * s[i] - 2 * m[i] - m[i + 1]) * ih,
+                  (m[i] + m[i + 1] - 2 * s[i]) * ih * ih}};
+      } else {
+        p_[i] = {{y[i], s[i], 0, 0}};
+      }
+    }
+  }
+
+  /// Evaluate polynomial of interval at number.
+  /// @param v  Abscissa, in units of the basis.
+  /// @param i  Offset of interval.
+  T eval(T v, size_t i) const {
+    v                = impl::clamp(v, ax_.front(), ax_.back());
+    T const        t = v - ax_[i];
+    T const *const c = p_[i].c;
+    return c[0] + t * (c[1] + t * (c[2] + t * c[3]));
+  }
+
+public:
+  /// Build table.
+  /// This will throw an exception if the numbers of abscissae and ordinates
+  /// differ, or if the abscissae be not strictly ascending.
+  /// @param x       Ascending abscissae.
+  /// @param y       Ordinates.
+  /// @param method  Method of interpolation.
+  basic_interp(std::vector<abscissa> const &x, std::vector<ordinate> const &y,
+               interp_method method = interp_method::linear)
+      : ax_(raw(x)), cub_(method == interp_method::monotone_cubic) {
+    fit(raw(y));
+  }
+
+  /// Build table from quantities of other types, such as
+  /// vnix::units::dbl::pressure.
+  /// This will throw an exception if the dimension of any abscissa or
+  /// ordinate be incompatible, if the numbers of abscissae and ordinates
+  /// differ, or if the abscissae be not strictly ascending.
+  /// @tparam QX      Type of abscissa.
+  /// @tparam QY      Type of ordinate.
+  /// @param  x       Ascending abscissae.
+  /// @param  y       Ordinates.
+  /// @param  method  Method of interpolation.
+  template <typename QX, typename QY>
+  basic_interp(std::vector<QX> const &x, std::vector<QY> const &y,
+               interp_method method = interp_method::linear)
+      : basic_interp(std::vector<abscissa>(x.begin(), x.end()),
+                     std::vector<ordinate>(y.begin(), y.end()), method) {}
+
+  size_t size() const { return ax_.size(); }      ///< Number of points.
+  bool   uniform() const { return ax_.uniform(); } ///< True if uniform.
+
+  /// Interpolate ordinate at abscissa.
+  /// @param x  Abscissa.
+  ordinate operator()(abscissa const &x) const {
+    T const v = x.raw_number();
+    return dimval<T, statdim_base<DY>>(eval(v, ax_.bracket(v)), dim(DY));
+  }
+
+  /// Interpolate ordinate at each abscissa in span.
+  /// This will throw an exception if the spans be of different size.
+  /// @param x  Abscissae.
+  /// @param y  Ordinates.
+  void operator()(statdim_span<DX, T const> const &x,
+                  statdim_span<DY, T> const &      y) const {
+    size_t const n = x.size();
+    if (y.size() != n) { error("spans of different size"); }
+    T const *const xi = x.data();
+    T *const       yo = y.data();
+    uint32_t       idx[BLOCK];
+    T              tail[BLOCK]; // Partial block, padded.
+    for (size_t b = 0; b < n; b += BLOCK) {
+      size_t const m = (n - b < BLOCK ? n - b : size_t(BLOCK));
+      T const *    p = xi + b;
+      if (m < BLOCK) {
+        for (size_t i = 0; i < BLOCK; ++i) { tail[i] = (i < m ? p[i] : 0); }
+        p = tail;
+      }
+      ax_.template brackets<BLOCK>(p, idx);
+      for (size_t i = 0; i < m; ++i) { yo[b + i] = eval(p[i], idx[i]); }
+    }
+  }
+
+  /// Interpolate ordinate at each abscissa in span whose dimension is known
+  /// at run-time.  Each dimension is checked once.
+  /// This will throw an exception if a dimension be incompatible or if the
+  /// spans be of different size.
+  /// @tparam OT  Type of number in span of abscissae (possibly const).
+  /// @param  x   Abscissae.
+  /// @param  y   Ordinates.
+  template <typename OT>
+  void operator()(dyndim_span<OT> const &x, dyndim_span<T> const &y) const {
+    (*this)(x.template as<DX>(), y.template as<DY>());
+  }
+};
+
+
+/// Table of ordinate against two abscissae on a rectangular grid, with
+/// bilinear interpolation, such as heat capacity against temperature and
+/// pressure.
+///
+/// The ordinates are stored in row-major order, with the second abscissa
+/// varying fastest.  Evaluation outside the grid clamps each abscissa to the
+/// nearest edge.
+///
+/// @tparam DX  Encoding of dimension of first abscissa.
+/// @tparam DY  Encoding of dimension of second abscissa.
+/// @tparam DZ  Encoding of dimension of ordinate.
+/// @tparam T   Type of number (float, double, etc.).
+template <dim::word DX, dim::word DY, dim::word DZ, typename T>
+class basic_interp2 {
+public:
+  using abscissa1 = basic_statdim<DX, T>; ///< Type of first abscissa.
+  using abscissa2 = basic_statdim<DY, T>; ///< Type of second abscissa.
+  using ordinate  = basic_statdim<DZ, T>; ///< Type of ordinate.
+
+private:
+  impl::interp_axis<T> ax_; ///< First abscissae.
+  impl::interp_axis<T> ay_; ///< Second abscissae.
+  std::vector<T>       z_;  ///< Ordinates.
+
+  /// Raw numbers of quantities.
+  /// @tparam Q  Type of quantity.
+  /// @param  v  Quantities.
+  template <typename Q> static std::vector<T> raw(std::vector<Q> const &v) {
+    std::vector<T> r(v.size());
+    for (size_t i = 0; i < v.size(); ++i) { r[i] = v[i].raw_number(); }
+    return r;
+  }
+
+  /// Evaluate at pair of numbers.
+  /// @param u  First abscissa, in units of the basis.
+  /// @param v  Second abscissa, in units of the basis.
+  T eval(T u, T v) const {
+    u                = impl::clamp(u, ax_.front(), ax_.back());
+    v                = impl::clamp(v, ay_.front(), ay_.back());
+    size_t const   i = ax_.bracket(u);
+    size_t const   j = ay_.bracket(v);
+    T const        s = (u - ax_[i]) * ax_.inv(i);
+    T const        t = (v - ay_[j]) * ay_.inv(j);
+    T const *const z = z_.data() + i * ay_.size() + j;
+    T const *const w = z + ay_.size();
+    T const        a = z[0] + t * (z[1] - z[0]);
+    T const        b = w[0] + t * (w[1] - w[0]);
+    return a + s * (b - a);
+  }
+
+public:
+  /// Build table.
+  /// This will throw an exception if the number of ordinates be not the
+  /// product of the numbers of abscissae, or if the abscissae be not strictly
+  /// ascending.
+  /// @param x  Ascending first abscissae.
+  /// @param y  Ascending second abscissae.
+  /// @param z  Ordinates, in row-major order.
+  basic_interp2(std::vector<abscissa1> const &x,
+                std::vector<abscissa2> const &y,
+                std::vector<ordinate> const & z)
+      : ax_(raw(x)), ay_(raw(y)), z_(raw(z)) {
+    if (z_.size() != ax_.size() * ay_.size()) {
+      error("wrong number of ordinates for grid");
+    }
+  }
+
+  /// Build table from quantities of other types.
+  /// This will throw an exception if a dimension be incompatible, if the
+  /// number of ordinates be not the product of the numbers of abscissae, or
+  /// if the abscissae be not strictly ascending.
+  /// @tparam QX  Type of first abscissa.
+  /// @tparam QY  Type of second abscissa.
+  /// @tparam QZ  Type of ordinate.
+  /// @param  x   Ascending first abscissae.
+  /// @param  y   Ascending second abscissae.
+  /// @param  z   Ordinates, in row-major order.
+  template <typename QX, typename QY, typename QZ>
+  basic_interp2(std::vector<QX> const &x, std::vector<QY> const &y,
+                std::vector<QZ> const &z)
+      : basic_interp2(std::vector<abscissa1>(x.begin(), x.end()),
+                      std::vector<abscissa2>(y.begin(), y.end()),
+                      std::vector<ordinate>(z.begin(), z.end())) {}
+
+  /// Interpolate ordinate at pair of abscissae.
+  /// @param x  First abscissa.
+  /// @param y  Second abscissa.
+  ordinate operator()(abscissa1 const &x, abscissa2 const &y) const {
+    T const z = eval(x.raw_number(), y.raw_number());
+    return dimval<T, statdim_base<DZ>>(z, dim(DZ));
+  }
+
+  /// Interpolate ordinate at each pair of abscissae in spans.
+  /// This will throw an exception if the spans be of different size.
+  /// @param x  First abscissae.
+  /// @param y  Second abscissae.
+  /// @param z  Ordinates.
+  void operator()(statdim_span<DX, T const> const &x,
+                  statdim_span<DY, T const> const &y,
+                  statdim_span<DZ, T> const &      z) const {
+    size_t const n = x.size();
+    if (y.size() != n || z.size() != n) { error("spans of different size"); }
+    T const *const xi = x.data();
+    T const *const yi = y.data();
+    T *const       zo = z.data();
+    for (size_t i = 0; i < n; ++i) { zo[i] = eval(xi[i], yi[i]); }
+  }
+};
+
+
+/// Interpolation-table of quantity of type QY against quantity of type QX,
+/// such as vnix::units::dbl::pressure against vnix::units::dbl::length.
+/// @tparam QX  Type of abscissa.
+/// @tparam QY  Type of ordinate.
+template <typename QX, typename QY>
+using interp =
+    basic_interp<QX::d().encode(), QY::d().encode(),
+                 std::decay_t<decltype(std::declval<QX>().raw_number())>>;
+
+
+/// Bilinear interpolation-table of quantity of type QZ against quantities of
+/// types QX and QY.
+/// @tparam QX  Type of first abscissa.
+/// @tparam QY  Type of second abscissa.
+/// @tparam QZ  Type of ordinate.
+template <typename QX, typename QY, typename QZ>
+using interp2 = basic_interp2<
+    QX::d().encode(), QY::d().encode(), QZ::d().encode(),
+    std::decay_t<decltype(std::declval<QX>().raw_number())>>;
+
+
+} // namespace units
+} // namespace vnix
+
+#endif // ndef VNIX_UNITS_INTERP_HPP
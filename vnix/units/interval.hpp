@@ -0,0 +1,486 @@
+/// @file       vnix/units/interval.hpp
+/// @brief      Definition of vnix::units::interval and basic_interval_batch.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD Three-Clause; see LICENSE.
+
+#ifndef VNIX_UNITS_INTERVAL_HPP
+#define VNIX_UNITS_INTERVAL_HPP
+
+#include <cmath>                     // for sqrt, pow, abs, floor
+#include <limits>                    // for numeric_limits
+#include <ostream>                   // for ostream
+#include <vector>                    // for vector
+#include <vnix/units/dimval.hpp>     // for dimval, basic_dyndim
+#include <vnix/units/soa-kernel.hpp> // for soa_apply
+
+namespace vnix {
+namespace units {
+namespace impl {
+
+
+/// Number certainly no greater than exact value whose rounding to nearest is
+/// x.  Because the distance from x to the next number is no greater than
+/// |x| * epsilon, x is moved by at least one unit in the last place, and so
+/// outward rounding needs no change of the mode of rounding, and the same
+/// arithmetic vectorizes.  Operands are assumed finite, and subnormals must
+/// not be flushed to zero.
+/// @tparam T  Type of number.
+/// @param  x  Result of operation rounded to nearest.
+template <typename T> inline T down(T x) {
+  return x - (std::abs(x) * std::numeric_limits<T>::epsilon() +
+              std::numeric_limits<T>::denorm_min());
+}
+
+/// Number certainly no less than exact value whose rounding to nearest is x.
+/// @tparam T  Type of number.
+/// @param  x  Result of operation rounded to nearest.
+template <typename T> inline T up(T x) {
+  return x + (std::abs(x) * std::numeric_limits<T>::epsilon() +
+              std::numeric_limits<T>::denorm_min());
+}
+
+/// Lesser of two numbers, in a form that vectorizes.
+template <typename T> inline T min2(T a, T b) { return a < b ? a : b; }
+
+/// Greater of two numbers, in a form that vectorizes.
+template <typename T> inline T max2(T a, T b) { return a > b ? a : b; }
+
+/// Lower and upper bounds of product of two intervals.
+/// @tparam T    Type of number.
+/// @param  al   Lower bound of left-hand factor.
+/// @param  ah   Upper bound of left-hand factor.
+/// @param  bl   Lower bound of right-hand factor.
+/// @param  bh   Upper bound of right-hand factor.
+/// @param  ol   Lower bound of product.
+/// @param  oh   Upper bound of product.
+template <typename T>
+inline void ival_mul(T al, T ah, T bl, T bh, T &ol, T &oh) {
+  T const p1 = al * bl, p2 = al * bh, p3 = ah * bl, p4 = ah * bh;
+  ol         = down(min2(min2(p1, p2), min2(p3, p4)));
+  oh         = up(max2(max2(p1, p2), max2(p3, p4)));
+}
+
+/// Lower and upper bounds of quotient of two intervals.  If the divisor
+/// contain zero, then the quotient is the whole real line.
+/// @tparam T    Type of number.
+/// @param  al   Lower bound of dividend.
+/// @param  ah   Upper bound of dividend.
+/// @param  bl   Lower bound of divisor.
+/// @param  bh   Upper bound of divisor.
+/// @param  ol   Lower bound of quotient.
+/// @param  oh   Upper bound of quotient.
+template <typename T>
+inline void ival_div(T al, T ah, T bl, T bh, T &ol, T &oh) {
+  T const    q1 = al / bl, q2 = al / bh, q3 = ah / bl, q4 = ah / bh;
+  bool const z  = (bl <= 0 && bh >= 0);
+  T const    inf = std::numeric_limits<T>::infinity();
+  ol             = z ? -inf : down(min2(min2(q1, q2), min2(q3, q4)));
+  oh             = z ? inf : up(max2(max2(q1, q2), max2(q3, q4)));
+}
+
+/// Lower and upper bounds of square-root of interval.  The negative part of
+/// the interval is ignored.
+/// @tparam T    Type of number.
+/// @param  al   Lower bound of radicand.
+/// @param  ah   Upper bound of radicand.
+/// @param  ol   Lower bound of root.
+/// @param  oh   Upper bound of root.
+template <typename T> inline void ival_sqrt(T al, T ah, T &ol, T &oh) {
+  ol = max2(down(std::sqrt(max2(al, T(0)))), T(0));
+  oh = up(std::sqrt(ah));
+}
+
+/// Combine directed powers of magnitudes of bounds into bounds of power.
+/// @tparam T    Type of number.
+/// @param  al   Lower bound of base.
+/// @param  ah   Upper bound of base.
+/// @param  odd  True if exponent be odd.
+/// @param  dl   Lower bound of |al|^n.
+/// @param  ul   Upper bound of |al|^n.
+/// @param  dh   Lower bound of |ah|^n.
+/// @param  uh   Upper bound of |ah|^n.
+/// @param  ol   Lower bound of power.
+/// @param  oh   Upper bound of power.
+template <typename T>
+inline void ival_pow_combine(T al, T ah, bool odd, T dl, T ul, T dh, T uh,
+                             T &ol, T &oh) {
+  if (odd) {
+    ol = (al >= 0 ? dl : -ul);
+    oh = (ah >= 0 ? uh : -dh);
+  } else {
+    ol = (al >= 0 ? dl : ah <= 0 ? dh : T(0));
+    oh = (al >= 0 ? uh : ah <= 0 ? ul : max2(ul, uh));
+  }
+}
+
+
+} // namespace impl
+
+
+/// Closed interval of real numbers, for use as the numeric type of a dimval,
+/// as in `dimval<interval<double>, B>`.
+///
+/// Each of +, -, *, /, sqrt, and integer power returns an interval that
+/// certainly contains every result of the operation on members of the
+/// operands.  Each bound is computed by rounding to nearest and then moved
+/// outward by at least one unit in the last place, so that the mode of
+/// rounding is never changed.  A non-integer power other than one half is
+/// bounded by way of std::pow and is only as reliable as std::pow.
+///
+/// @tparam T  Type of number (float, double, etc.).
+template <typename T> struct interval {
+  T lo; ///< Lower bound.
+  T hi; ///< Upper bound.
+
+  interval() {} ///< By default, do not initialize.
+
+  /// Initialize degenerate interval, which contains only x.
+  /// @param x  Exact number.
+  constexpr interval(T x) : lo(x), hi(x) {}
+
+  /// Initialize from bounds.
+  /// This will throw an exception if the lower bound exceed the upper bound.
+  /// @param l  Lower bound.
+  /// @param h  Upper bound.
+  constexpr interval(T l, T h) : lo(l), hi(h) {
+    if (l > h) { error("lower bound above upper bound"); }
+  }
+
+  constexpr T width() const { return hi - lo; } ///< Width (rounded).
+
+  /// True if interval contain number.
+  /// @param x  Number.
+  constexpr bool contains(T x) const { return lo <= x && x <= hi; }
+
+  /// Sum.
+  friend interval operator+(interval const &a, interval const &b) {
+    return raw(impl::down(a.lo + b.lo), impl::up(a.hi + b.hi));
+  }
+
+  /// Difference.
+  friend interval operator-(interval const &a, interval const &b) {
+    return raw(impl::down(a.lo - b.hi), impl::up(a.hi - b.lo));
+  }
+
+  /// Negation, which is exact.
+  friend constexpr interval operator-(interval const &a) {
+    return raw(-a.hi, -a.lo);
+  }
+
+  /// Product.
+  friend interval operator*(interval const &a, interval const &b) {
+    interval r;
+    impl::ival_mul(a.lo, a.hi, b.lo, b.hi, r.lo, r.hi);
+    return r;
+  }
+
+  /// Quotient.
+  friend interval operator/(interval const &a, interval const &b) {
+    interval r;
+    impl::ival_div(a.lo, a.hi, b.lo, b.hi, r.lo, r.hi);
+    return r;
+  }
+
+  /// Multiply in place.
+  interval &operator*=(interval const &b) { return *this = *this * b; }
+
+  /// Divide in place.
+  interval &operator/=(interval const &b) { return *this = *this / b; }
+
+  /// Equality of bounds.
+  friend constexpr bool operator==(interval const &a, interval const &b) {
+    return a.lo == b.lo && a.hi == b.hi;
+  }
+
+  /// Inequality of bounds.
+  friend constexpr bool operator!=(interval const &a, interval const &b) {
+    return !(a == b);
+  }
+
+  /// True if every member of a be less than every member of b.
+  friend constexpr bool operator<(interval const &a, interval const &b) {
+    return a.hi < b.lo;
+  }
+
+  /// True if every member of a be greater than every member of b.
+  friend constexpr bool operator>(interval const &a, interval const &b) {
+    return a.lo > b.hi;
+  }
+
+  /// True if no member of a be greater than any member of b.
+  friend constexpr bool operator<=(interval const &a, interval const &b) {
+    return a.hi <= b.lo;
+  }
+
+  /// True if no member of a be less than any member of b.
+  friend constexpr bool operator>=(interval const &a, interval const &b) {
+    return a.lo >= b.hi;
+  }
+
+  /// Integer power.
+  /// @param a  Base.
+  /// @param n  Exponent.
+  friend interval ipow(interval const &a, int n) {
+    if (n < 0) { return interval(T(1)) / ipow(a, -n); }
+    if (n == 0) { return interval(T(1)); }
+    T const al = std::abs(a.lo), ah = std::abs(a.hi);
+    T       dl = al, ul = al, dh = ah, uh = ah;
+    for (int k = 1; k < n; ++k) {
+      dl = impl::max2(impl::down(dl * al), T(0));
+      ul = impl::up(ul * al);
+      dh = impl::max2(impl::down(dh * ah), T(0));
+      uh = impl::up(uh * ah);
+    }
+    interval r;
+    impl::ival_pow_combine(a.lo, a.hi, (n & 1) != 0, dl, ul, dh, uh, r.lo,
+                           r.hi);
+    return r;
+  }
+
+  /// Real power, for dimval::power().
+  /// @param a  Base.
+  /// @param p  Exponent.
+  friend interval pow(interval const &a, double p) {
+    if (p == std::floor(p) && std::abs(p) < 1.0E+09) { return ipow(a, int(p)); }
+    if (p == 0.5) { return sqrt(a); }
+    T const l = impl::max2(a.lo, T(0));
+    T const x = T(std::pow(l, p)), y = T(std::pow(a.hi, p));
+    T const lo = (p > 0 ? x : y), hi = (p > 0 ? y : x);
+    return raw(impl::down(impl::down(lo)), impl::up(impl::up(hi)));
+  }
+
+  /// Square-root, for dimval::square_root().
+  /// @param a  Radicand.
+  friend interval sqrt(interval const &a) {
+    interval r;
+    impl::ival_sqrt(a.lo, a.hi, r.lo, r.hi);
+    return r;
+  }
+
+  /// Print as "[lo, hi]".
+  friend std::ostream &operator<<(std::ostream &os, interval const &a) {
+    return os << "[" << a.lo << ", " << a.hi << "]";
+  }
+
+private:
+  /// Interval from bounds, without check.
+  constexpr static interval raw(T l, T h) {
+    interval r;
+    r.lo = l;
+    r.hi = h;
+    return r;
+  }
+};
+
+
+/// Quantity whose number is an interval, from bounds.
+/// This will throw an exception if the dimensions, known only at run-time, be
+/// different, or if the lower bound exceed the upper bound.
+/// @tparam T   Type of number.
+/// @tparam B   Base of lower bound.
+/// @tparam OB  Base of upper bound.
+/// @param  l   Lower bound.
+/// @param  h   Upper bound.
+template <typename T, typename B, typename OB>
+constexpr dimval<interval<T>, B> between(dimval<T, B> const & l,
+                                         dimval<T, OB> const &h) {
+  l.comparison(h);
+  return dimval<interval<T>, B>(interval<T>(l.raw_number(), h.raw_number()),
+                                l.d());
+}
+
+/// Lower bound of quantity whose number is an interval.
+/// @tparam T  Type of number.
+/// @tparam B  Base of quantity.
+/// @param  q  Quantity.
+template <typename T, typename B>
+constexpr dimval<T, B> lower(dimval<interval<T>, B> const &q) {
+  return dimval<T, B>(q.raw_number().lo, q.d());
+}
+
+/// Upper bound of quantity whose number is an interval.
+/// @tparam T  Type of number.
+/// @tparam B  Base of quantity.
+/// @param  q  Quantity.
+template <typename T, typename B>
+constexpr dimval<T, B> upper(dimval<interval<T>, B> const &q) {
+  return dimval<T, B>(q.raw_number().hi, q.d());
+}
+
+
+/// Structure of arrays of quantities whose numbers are intervals, all of one
+/// dimension.
+///
+/// Lower and upper bounds are stored in separate arrays, in units of the
+/// basis, and the dimension is stored once.  Arithmetic on two batches
+/// computes the dimension of the result once and bounds every element in a
+/// loop that the compiler can vectorize, with the same outward rounding as
+/// interval, and so without any change of the mode of rounding.
+///
+/// @tparam T  Type of number (float, double, etc.).
+template <typename T> class basic_interval_batch {
+  std::vector<T> lo_; ///< Lower bounds.
+  std::vector<T> hi_; ///< Upper bounds.
+  dim            d_;  ///< Dimension of every element.
+
+public:
+  /// Initialize batch whose every element is zero.
+  /// @param n   Number of elements.
+  /// @param dd  Dimension of every element.
+  basic_interval_batch(size_t n = 0, dim dd = nul_dim)
+      : lo_(n), hi_(n), d_(dd) {}
+
+  size_t   size() const { return lo_.size(); } ///< Number of elements.
+  dim      d() const { return d_; }           ///< Dimension of every element.
+  T *      lowers() { return lo_.data(); }    ///< Lower bounds.
+  T *      uppers() { return hi_.data(); }    ///< Upper bounds.
+  T const *lowers() const { return lo_.data(); } ///< Lower bounds.
+  T const *uppers() const { return hi_.data(); } ///< Upper bounds.
+
+  /// Element at offset.
+  /// @param i  Offset of element.
+  basic_dyndim<interval<T>> operator[](size_t i) const {
+    return dimval<interval<T>, dyndim_base>(interval<T>(lo_[i], hi_[i]), d_);
+  }
+
+  /// Replace element at offset.
+  /// This will throw an exception if the dimensions be different.
+  /// @tparam B  Base of quantity.
+  /// @param  i  Offset of element.
+  /// @param  q  New quantity.
+  template <typename B> void set(size_t i, dimval<interval<T>, B> const &q) {
+    if (q.d() != d_) { error("incompatible dimension for batch"); }
+    lo_[i] = q.raw_number().lo;
+    hi_[i] = q.raw_number().hi;
+  }
+
+  /// Add batch of same dimension in place.
+  /// @param b  Addend.
+  basic_interval_batch &operator+=(basic_interval_batch const &b) {
+    if (d_ != b.d_) { error("incompatible dimensions for addition"); }
+    return apply(b, d_, [](T al, T ah, T bl, T bh, T &ol, T &oh) {
+      ol = impl::down(al + bl);
+      oh = impl::up(ah + bh);
+    });
+  }
+
+  /// Subtract batch of same dimension in place.
+  /// @param b  Subtrahend.
+  basic_interval_batch &operator-=(basic_interval_batch const &b) {
+    if (d_ != b.d_) { error("incompatible dimensions for subtraction"); }
+    return apply(b, d_, [](T al, T ah, T bl, T bh, T &ol, T &oh) {
+      ol = impl::down(al - bh);
+      oh = impl::up(ah - bl);
+    });
+  }
+
+  /// Multiply by batch in place.
+  /// @param b  Factor.
+  basic_interval_batch &operator*=(basic_interval_batch const &b) {
+    return apply(b, d_ + b.d_, impl::ival_mul<T>);
+  }
+
+  /// Divide by batch in place.
+  /// @param b  Divisor.
+  basic_interval_batch &operator/=(basic_interval_batch const &b) {
+    return apply(b, d_ - b.d_, impl::ival_div<T>);
+  }
+
+  /// Sum of two batches.
+  friend basic_interval_batch operator+(basic_interval_batch        a,
+                                        basic_interval_batch const &b) {
+    return a += b;
+  }
+
+  /// Difference of two batches.
+  friend basic_interval_batch operator-(basic_interval_batch        a,
+                                        basic_interval_batch const &b) {
+    return a -= b;
+  }
+
+  /// Product of two batches.
+  friend basic_interval_batch operator*(basic_interval_batch        a,
+                                        basic_interval_batch const &b) {
+    return a *= b;
+  }
+
+  /// Quotient of two batches.
+  friend basic_interval_batch operator/(basic_interval_batch        a,
+                                        basic_interval_batch const &b) {
+    return a /= b;
+  }
+
+  /// Square-root of every element.
+  /// @param a  Batch.
+  friend basic_interval_batch sqrt(basic_interval_batch a) {
+    return a.apply(a, a.d_ / dim::rat(2), [](T al, T ah, T, T, T &ol, T &oh) {
+      impl::ival_sqrt(al, ah, ol, oh);
+    });
+  }
+
+  /// Integer power of every element.  Each step of the power is a separate
+  /// pass over a block, so that every pass vectorizes.
+  /// @param a  Batch.
+  /// @param n  Exponent.
+  friend basic_interval_batch ipow(basic_interval_batch a, int n) {
+    if (n <= 0) {
+      basic_interval_batch one(a.size(), nul_dim);
+      for (size_t i = 0; i < a.size(); ++i) { one.lo_[i] = one.hi_[i] = 1; }
+      return n ? one /= ipow(a, -n) : one;
+    }
+    dim const     d = a.d_ * dim::rat(n);
+    size_t const  B = impl::SOA_BLOCK;
+    T             dl[B], ul[B], dh[B], uh[B], al[B], ah[B];
+    for (size_t b = 0; b < a.size(); b += B) {
+      size_t const m  = (a.size() - b < B ? a.size() - b : B);
+      T *const     lo = a.lowers() + b;
+      T *const     hi = a.uppers() + b;
+      for (size_t i = 0; i < m; ++i) {
+        al[i] = std::abs(lo[i]);
+        ah[i] = std::abs(hi[i]);
+      }
+      for (size_t i = m; i < B; ++i) { al[i] = ah[i] = al[0]; }
+      for (size_t i = 0; i < B; ++i) {
+        dl[i] = ul[i] = al[i];
+        dh[i] = uh[i] = ah[i];
+      }
+      for (int k = 1; k < n; ++k) {
+        for (size_t i = 0; i < B; ++i) {
+          dl[i] = impl::max2(impl::down(dl[i] * al[i]), T(0));
+          ul[i] = impl::up(ul[i] * al[i]);
+          dh[i] = impl::max2(impl::down(dh[i] * ah[i]), T(0));
+          uh[i] = impl::up(uh[i] * ah[i]);
+        }
+      }
+      bool const odd = (n & 1) != 0;
+      for (size_t i = 0; i < m; ++i) {
+        impl::ival_pow_combine(lo[i], hi[i], odd, dl[i], ul[i], dh[i], uh[i],
+                               lo[i], hi[i]);
+      }
+    }
+    a.d_ = d;
+    return a;
+  }
+
+private:
+  /// Apply operation, element by element, to this batch and to other batch
+  /// of same size, and replace this batch by result.
+  /// @tparam F   Type of function(al, ah, bl, bh, ol, oh).
+  /// @param  b   Other batch, which may be this batch.
+  /// @param  dd  Dimension of result.
+  /// @param  f   Operation on one element.
+  template <typename F>
+  basic_interval_batch &apply(basic_interval_batch const &b, dim dd, F f) {
+    if (size() != b.size()) { error("batches of different size"); }
+    impl::soa_apply(lo_.data(), hi_.data(), b.lo_.data(), b.hi_.data(),
+                    lo_.data(), hi_.data(), size(), f);
+    d_ = dd;
+    return *this;
+  }
+};
+
+
+} // namespace units
+} // namespace vnix
+
+#endif // ndef VNIX_UNITS_INTERVAL_HPP
@@ -7,6 +7,7 @@
 #define VNIX_UNITS_NUMBER_HPP
 
 #include <cstdlib>
+#include <vnix/units/dim.hpp> // for VNIX_UNITS_INLINE
 
 namespace Eigen {
 
@@ -25,6 +26,10 @@ template <typename T, size_t NR, size_t NC> struct mat;
 
 namespace units {
 
+template <typename T, size_t N> struct dual;
+template <typename T> struct interval;
+template <typename T> struct uncertain;
+
 
 /// Base-struct for wrapper to disambiguate scalar from dimval and protected
 /// storage for numeric value associated with a physical unit.
@@ -44,7 +49,7 @@ template <typename T> struct basic_number {
 
   /// Initialize numeric value and exponents of units.
   /// @param v  Numeric value that multiplies units.
-  constexpr basic_number(T const &vv) : v_(vv) {}
+  VNIX_UNITS_INLINE constexpr basic_number(T const &vv) : v_(vv) {}
 };
 
 
@@ -145,6 +150,30 @@ struct number<mv::mat<T, NR, NC>> : public basic_number<mv::mat<T, NR, NC>> {
   using test = int; ///< For SFINAE, type defined only in specialization.
 };
 
+/// Specialization of scalar for vnix::units::dual.
+template <typename T, size_t N>
+struct number<dual<T, N>> : public basic_number<dual<T, N>> {
+  /// Inherit constructor.
+  using basic_number<dual<T, N>>::basic_number;
+  using test = int; ///< For SFINAE, type defined only in specialization.
+};
+
+/// Specialization of scalar for vnix::units::interval.
+template <typename T>
+struct number<interval<T>> : public basic_number<interval<T>> {
+  /// Inherit constructor.
+  using basic_number<interval<T>>::basic_number;
+  using test = int; ///< For SFINAE, type defined only in specialization.
+};
+
+/// Specialization of scalar for vnix::units::uncertain.
+template <typename T>
+struct number<uncertain<T>> : public basic_number<uncertain<T>> {
+  /// Inherit constructor.
+  using basic_number<uncertain<T>>::basic_number;
+  using test = int; ///< For SFINAE, type defined only in specialization.
+};
+
 /// Specialization of scalar for Eigen::Matrix.
 template <typename S, int R, int C, int OPT, int MR, int MC>
 struct number<Eigen::Matrix<S, R, C, OPT, MR, MC>>
@@ -176,6 +205,22 @@ struct number<Eigen::Product<L, R, OPT>>
 };
 
 
+/// Type in which the scale-factor of a unit multiplies a number of type T.
+///
+/// Each scale-factor is computed at compile-time in long double.  For float
+/// or double, it is then rounded to T, so that construction from a number of
+/// units is a single multiplication in T and not one in long double.
+///
+/// @tparam T  Type of number.
+template <typename T> struct scale_factor { using type = long double; };
+template <> struct scale_factor<float> { using type = float; };
+template <> struct scale_factor<double> { using type = double; };
+
+/// Type in which the scale-factor of a unit multiplies a number of type T.
+/// @tparam T  Type of number.
+template <typename T> using scale_t = typename scale_factor<T>::type;
+
+
 } // namespace units
 } // namespace vnix
 
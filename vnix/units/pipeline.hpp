@@ -0,0 +1,297 @@
+/// @file       vnix/units/pipeline.hpp
+/// @brief      Definition of vnix::units::basic_pipeline and basic_batch.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD Three-Clause; see LICENSE.
+
+#ifndef VNIX_UNITS_PIPELINE_HPP
+#define VNIX_UNITS_PIPELINE_HPP
+
+#include <atomic>                       // for atomic
+#include <condition_variable>           // for condition_variable
+#include <deque>                        // for deque
+#include <exception>                    // for exception_ptr
+#include <functional>                   // for function
+#include <memory>                       // for unique_ptr
+#include <mutex>                        // for mutex, unique_lock
+#include <thread>                       // for thread
+#include <utility>                      // for move
+#include <vector>                       // for vector
+#include <vnix/units/quantity-span.hpp> // for dyndim_span
+
+namespace vnix {
+namespace units {
+
+
+/// Batch of quantities that share a dimension, passed from stage to stage of
+/// a basic_pipeline.
+///
+/// The numbers are stored contiguously, in units of the basis, and the
+/// dimension is stored once for the whole batch.
+///
+/// @tparam T  Type of number (float, double, etc.).
+template <typename T> struct basic_batch {
+  std::vector<T> v;           ///< Numbers, in units of the basis.
+  dim            d = nul_dim; ///< Dimension shared by every number.
+  size_t         seq = 0;     ///< Offset of batch in stream from source.
+
+  /// View of numbers, with dimension.
+  dyndim_span<T> span() { return dyndim_span<T>(v.data(), v.size(), d); }
+
+  /// View of numbers, with dimension.
+  dyndim_span<T const> span() const {
+    return dyndim_span<T const>(v.data(), v.size(), d);
+  }
+
+  /// View of numbers after single check of dimension.
+  /// This will throw an exception if the dimension of the batch be not D.
+  /// @tparam D  Encoding of expected dimension.
+  template <dim::word D> statdim_span<D, T> as() {
+    return span().template as<D>();
+  }
+};
+
+
+namespace impl {
+
+
+/// Queue of limited size, for which push() blocks while the queue is full,
+/// and pop() blocks while the queue is empty.
+/// @tparam X  Type of element.
+template <typename X> class bounded_queue {
+  std::mutex              mtx_;       ///< Lock on queue.
+  std::condition_variable not_full_;  ///< Signal on pop() and close().
+  std::condition_variable not_empty_; ///< Signal on push() and close().
+  std::deque<X>           q_;         ///< Elements.
+  size_t                  cap_;       ///< Maximum number of elements.
+  bool                    closed_;    ///< True after close().
+
+public:
+  /// Initialize empty queue.
+  /// @param cap  Maximum number of elements.
+  explicit bounded_queue(size_t cap) : cap_(cap ? cap : 1), closed_(false) {}
+
+  /// Append element, and wait while queue is full.
+  /// @param x  Element.
+  /// @return   False if queue was closed.
+  bool push(X &&x) {
+    std::unique_lock<std::mutex> lock(mtx_);
+    not_full_.wait(lock, [this] { return closed_ || q_.size() < cap_; });
+    if (closed_) { return false; }
+    q_.push_back(std::move(x));
+    not_empty_.notify_one();
+    return true;
+  }
+
+  /// Remove first element, and wait while queue is empty.
+  /// @param x  Destination of element.
+  /// @return   False if queue was closed and is empty.
+  bool pop(X &x) {
+    std::unique_lock<std::mutex> lock(mtx_);
+    not_empty_.wait(lock, [this] { return closed_ || !q_.empty(); });
+    if (q_.empty()) { return false; }
+    x = std::move(q_.front());
+    q_.pop_front();
+    not_full_.notify_one();
+    return true;
+  }
+
+  /// Refuse further push(), but allow remaining elements to be popped.
+  /// @param discard  True if remaining elements should be dropped.
+  void close(bool discard = false) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    closed_ = true;
+    if (discard) { q_.clear(); }
+    not_full_.notify_all();
+    not_empty_.notify_all();
+  }
+};
+
+
+} // namespace impl
+
+
+/// Chain of stages, such as decode, convert, filter, aggregate, and sink,
+/// each of which runs on its own thread or threads and passes batches of
+/// quantities to the next stage through a bounded queue.
+///
+/// When a stage be slower than its predecessor, the queue between them fills,
+/// and the predecessor waits, so that the memory in use is limited.  Each
+/// stage declares the dimension of batch that it accepts, and the dimension
+/// is checked once per batch, as the batch enters the stage, rather than
+/// once per element.  A stage may change the dimension of a batch that it
+/// passes on.  Batches are recycled from the end of the pipeline back to the
+/// source, so that, in a steady state, no memory is allocated.
+///
+/// If any stage throw an exception, then every stage is stopped, and run()
+/// rethrows the first exception.
+///
+/// @tparam T  Type of number (float, double, etc.).
+template <typename T> class basic_pipeline {
+public:
+  using batch = basic_batch<T>; ///< Type of batch.
+
+  /// Function that fills batch and returns false at end of stream.
+  using source_fn = std::function<bool(batch &)>;
+
+  /// Function that transforms batch in place and returns false if batch
+  /// should be dropped.
+  using stage_fn = std::function<bool(batch &)>;
+
+private:
+  /// Description of stage.
+  struct stage_desc {
+    dim      in;      ///< Dimension accepted.
+    stage_fn f;       ///< Work on batch.
+    unsigned workers; ///< Number of threads.
+  };
+
+  using queue = impl::bounded_queue<batch>; ///< Type of queue.
+
+  size_t                  cap_;      ///< Capacity of each queue.
+  source_fn               source_;   ///< Producer of batches.
+  std::vector<stage_desc> stages_;   ///< Consumers of batches.
+  std::mutex              free_mtx_; ///< Lock on recycled batches.
+  std::vector<batch>      free_;     ///< Recycled batches.
+
+  /// Take recycled batch, or make new one.
+  batch take() {
+    std::lock_guard<std::mutex> lock(free_mtx_);
+    if (free_.empty()) { return batch(); }
+    batch b = std::move(free_.back());
+    free_.pop_back();
+    return b;
+  }
+
+  /// Recycle batch.
+  /// @param b  Batch no longer needed.
+  void give(batch &&b) {
+    b.v.clear(); // Keep capacity.
+    std::lock_guard<std::mutex> lock(free_mtx_);
+    free_.push_back(std::move(b));
+  }
+
+public:
+  /// Initialize empty pipeline.
+  /// @param cap  Maximum number of batches waiting between two stages.
+  explicit basic_pipeline(size_t cap = 4) : cap_(cap) {}
+
+  /// Set source of batches, such as decoder of stream.  The source runs on
+  /// its own thread and should set the numbers and the dimension of each
+  /// batch.  The batch passed to the source may be recycled; its numbers are
+  /// cleared, but its capacity is kept.
+  /// @param f  Function that fills batch and returns false at end of stream.
+  basic_pipeline &source(source_fn f) {
+    source_ = std::move(f);
+    return *this;
+  }
+
+  /// Append stage.
+  /// @param in       Dimension of batch accepted by stage.
+  /// @param f        Function that transforms batch in place and returns false
+  ///                 if batch should be dropped.  If workers be greater than
+  ///                 one, then f is called concurrently, and batches might be
+  ///                 passed on out of order; see basic_batch::seq.
+  /// @param workers  Number of threads for stage.
+  basic_pipeline &stage(dim in, stage_fn f, unsigned workers = 1) {
+    stages_.push_back({in, std::move(f), workers ? workers : 1});
+    return *this;
+  }
+
+  /// Run source and every stage until source reach end of stream and every
+  /// batch be consumed.
+  void run() {
+    if (!source_) { return error("pipeline without source"); }
+    if (stages_.empty()) { return error("pipeline without stage"); }
+    size_t const                        ns = stages_.size();
+    std::vector<std::unique_ptr<queue>> q;
+    std::unique_ptr<std::atomic<unsigned>[]> left(
+        new std::atomic<unsigned>[ns]);
+    for (size_t i = 0; i < ns; ++i) {
+      q.emplace_back(new queue(cap_));
+      left[i] = stages_[i].workers;
+    }
+
+    std::mutex         err_mtx;
+    std::exception_ptr err;
+    auto               fail = [&] {
+      {
+        std::lock_guard<std::mutex> lock(err_mtx);
+        if (!err) { err = std::current_exception(); }
+      }
+      for (auto &x : q) { x->close(true); }
+    };
+
+#if !VNIX_EXCEPTIONS
+    char const *msg = nullptr; // First error in any thread.
+#endif
+
+    // Run f; on error, record it and close every queue.
+    auto guard = [&](auto f) {
+#if VNIX_EXCEPTIONS
+      try {
+        f();
+      } catch (...) { fail(); }
+#else
+      clear_error();
+      f();
+      if (char const *m = last_error()) {
+        {
+          std::lock_guard<std::mutex> lock(err_mtx);
+          if (!msg) { msg = m; }
+        }
+        fail();
+      }
+#endif
+    };
+
+    std::vector<std::thread> threads;
+    threads.emplace_back([&] {
+      guard([&] {
+        for (size_t seq = 0;; ++seq) {
+          batch b = take();
+          b.seq   = seq;
+          if (!source_(b) || !q[0]->push(std::move(b))) { break; }
+        }
+      });
+      q[0]->close();
+    });
+
+    for (size_t i = 0; i < ns; ++i) {
+      for (unsigned w = 0; w < stages_[i].workers; ++w) {
+        threads.emplace_back([&, i] {
+          guard([&] {
+            stage_desc const &s = stages_[i];
+            batch             b;
+            while (q[i]->pop(b)) {
+              if (b.d != s.in) {
+                error("batch of wrong dimension for stage");
+                break; // Reached only if error-handler return.
+              }
+              if (!s.f(b)) {
+                give(std::move(b));
+              } else if (i + 1 == ns) {
+                give(std::move(b));
+              } else if (!q[i + 1]->push(std::move(b))) {
+                break;
+              }
+            }
+          });
+          if (--left[i] == 0 && i + 1 < ns) { q[i + 1]->close(); }
+        });
+      }
+    }
+
+    for (auto &t : threads) { t.join(); }
+#if VNIX_EXCEPTIONS
+    if (err) { std::rethrow_exception(err); }
+#else
+    if (msg) { error(msg); }
+#endif
+  }
+};
+
+
+} // namespace units
+} // namespace vnix
+
+#endif // ndef VNIX_UNITS_PIPELINE_HPP
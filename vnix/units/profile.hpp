@@ -0,0 +1,284 @@
+/// @file       vnix/units/profile.hpp
+/// @brief      Definition of vnix::units::profiler and VNIX_UNITS_SITE.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD Three-Clause; see LICENSE.
+///
+/// When VNIX_UNITS_PROFILE is defined, `VNIX_UNITS_SITE(x)` records, for the
+/// line on which it appears, the number of times that x was evaluated and
+/// each dimension that x had.  Otherwise, `VNIX_UNITS_SITE(x)` is just x.
+///
+/// Wrap each interesting expression of type basic_dyndim, and run the
+/// program.  Then profiler::report() lists the sites, hottest first, and
+/// marks each site that saw only one dimension as a candidate for
+/// basic_statdim, with the name of the type, such as `dbl::speed`, to use.
+
+#ifndef VNIX_UNITS_PROFILE_HPP
+#define VNIX_UNITS_PROFILE_HPP
+
+#include <algorithm>                // for sort
+#include <cstdint>                  // for uint64_t
+#include <cstring>                  // for strcmp
+#include <mutex>                    // for mutex, lock_guard
+#include <ostream>                  // for ostream
+#include <sstream>                  // for ostringstream
+#include <string>                   // for string
+#include <type_traits>              // for decay_t
+#include <utility>                  // for forward, pair
+#include <vector>                   // for vector
+#include <vnix/units/unit-syms.hpp> // for find_dim_sym
+
+namespace vnix {
+namespace units {
+
+
+/// Observations at one site.
+struct site_report {
+  char const *file;  ///< Name of source-file.
+  unsigned    line;  ///< Line in source-file.
+  uint64_t    calls; ///< Number of evaluations.
+
+  /// Each dimension observed, with number of evaluations for each.
+  std::vector<std::pair<dim, uint64_t>> dims;
+
+  /// Type to use in place of dyndim, such as "dbl::speed", if only one
+  /// dimension was observed; otherwise, empty.
+  std::string suggestion;
+
+  /// True if only one dimension was observed, so that basic_statdim would do.
+  bool candidate() const { return dims.size() == 1; }
+};
+
+
+class site;
+
+
+namespace impl {
+
+
+/// Dimension as string, such as "m s^-1", without leading space.
+/// @param d  Dimension.
+inline std::string dim_str(dim d) {
+  std::ostringstream oss;
+  oss << d;
+  std::string const s = oss.str();
+  size_t const      i = s.find_first_not_of(' ');
+  return i == std::string::npos ? std::string() : s.substr(i);
+}
+
+
+} // namespace impl
+
+
+/// Registry of every site at which VNIX_UNITS_SITE has been evaluated.
+class profiler {
+  friend class site;
+
+  /// Registry of sites.
+  struct registry {
+    std::mutex          mtx;   ///< Lock on registry.
+    std::vector<site *> sites; ///< Every site.
+  };
+
+  /// Process-wide registry.
+  static registry &reg() {
+    static registry r;
+    return r;
+  }
+
+public:
+  /// Report on every site, hottest first, and, among sites with the same
+  /// number of calls, in order of file and line.
+  static std::vector<site_report> sites();
+
+  /// Forget every observation.
+  static void reset();
+
+  /// Print report, one line for each site, hottest first.
+  /// @param os  Stream to which report is printed.
+  static std::ostream &report(std::ostream &os) {
+    for (auto const &s : sites()) {
+      os << s.calls << " " << s.file << ":" << s.line;
+      if (s.candidate()) {
+        os << " candidate " << s.suggestion;
+      } else {
+        os << " mixed";
+        for (auto const &d : s.dims) {
+          os << " [" << impl::dim_str(d.first) << "]x" << d.second;
+        }
+      }
+      os << "\n";
+    }
+    return os;
+  }
+};
+
+
+namespace impl {
+
+
+/// Name of type T and prefix of namespace for types of quantity with
+/// numbers of type T.
+/// @tparam T  Type of number.
+template <typename T> struct prec_name {
+  constexpr static char const *num = "number"; ///< Name of type of number.
+  constexpr static char const *ns  = nullptr;  ///< Prefix of namespace.
+};
+
+/// Name of float and prefix of namespace for flt::length, etc.
+template <> struct prec_name<float> {
+  constexpr static char const *num = "float"; ///< Name of type of number.
+  constexpr static char const *ns  = "flt";   ///< Prefix of namespace.
+};
+
+/// Name of double and prefix of namespace for dbl::length, etc.
+template <> struct prec_name<double> {
+  constexpr static char const *num = "double"; ///< Name of type of number.
+  constexpr static char const *ns  = "dbl";    ///< Prefix of namespace.
+};
+
+/// Name of long double and prefix of namespace for ldbl::length, etc.
+template <> struct prec_name<long double> {
+  constexpr static char const *num = "long double"; ///< Name of type.
+  constexpr static char const *ns  = "ldbl";        ///< Prefix.
+};
+
+
+} // namespace impl
+
+
+/// Source-location at which dimensions are observed.
+class site {
+  char const *file_; ///< Name of source-file.
+  unsigned    line_; ///< Line in source-file.
+  char const *num_;  ///< Name of type of number, such as "double".
+  char const *prec_; ///< Prefix of namespace, such as "dbl".
+
+  mutable std::mutex                    mtx_;   ///< Lock on observations.
+  uint64_t                              calls_; ///< Number of evaluations.
+  std::vector<std::pair<dim, uint64_t>> dims_;  ///< Count for each dim.
+
+  /// Name of type for dimension.
+  /// @param d  Dimension.
+  std::string type_name(dim d) const {
+    std::ostringstream oss;
+    dim_sym const *    s = find_dim_sym(d);
+    if (d == nul_dim) {
+      oss << num_;
+    } else if (s && prec_) {
+      oss << prec_ << "::" << s->name;
+    } else {
+      oss << "basic_statdim<[" << impl::dim_str(d) << "]>";
+    }
+    return oss.str();
+  }
+
+public:
+  /// Register site.
+  /// @tparam T     Type of number in quantity.
+  /// @tparam B     Base of quantity.
+  /// @param  file  Name of source-file.
+  /// @param  line  Line in source-file.
+  template <typename T, typename B>
+  site(char const *file, unsigned line, dimval<T, B> const &)
+      : file_(file),
+        line_(line),
+        num_(impl::prec_name<T>::num),
+        prec_(impl::prec_name<T>::ns),
+        calls_(0) {
+    std::lock_guard<std::mutex> lock(profiler::reg().mtx);
+    profiler::reg().sites.push_back(this);
+  }
+
+  /// Unregister site.
+  ~site() {
+    std::lock_guard<std::mutex> lock(profiler::reg().mtx);
+    auto &v = profiler::reg().sites;
+    v.erase(std::remove(v.begin(), v.end(), this), v.end());
+  }
+
+  /// Record evaluation.
+  /// @param d  Dimension of value.
+  void record(dim d) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    ++calls_;
+    for (auto &p : dims_) {
+      if (p.first == d) {
+        ++p.second;
+        return;
+      }
+    }
+    dims_.push_back({d, 1});
+  }
+
+  /// Forget every observation.
+  void reset() {
+    std::lock_guard<std::mutex> lock(mtx_);
+    calls_ = 0;
+    dims_.clear();
+  }
+
+  /// Report on observations.
+  site_report report() const {
+    std::lock_guard<std::mutex> lock(mtx_);
+    site_report r{file_, line_, calls_, dims_, std::string()};
+    if (r.candidate()) { r.suggestion = type_name(dims_[0].first); }
+    return r;
+  }
+};
+
+
+inline std::vector<site_report> profiler::sites() {
+  std::vector<site_report>    r;
+  std::lock_guard<std::mutex> lock(reg().mtx);
+  for (site const *s : reg().sites) {
+    site_report sr = s->report();
+    if (sr.calls) { r.push_back(std::move(sr)); }
+  }
+  std::sort(r.begin(), r.end(), [](site_report const &a, site_report const &b) {
+    if (a.calls != b.calls) { return a.calls > b.calls; }
+    int const c = std::strcmp(a.file, b.file);
+    return c != 0 ? c < 0 : a.line < b.line;
+  });
+  return r;
+}
+
+
+inline void profiler::reset() {
+  std::lock_guard<std::mutex> lock(reg().mtx);
+  for (site *s : reg().sites) { s->reset(); }
+}
+
+
+namespace impl {
+
+
+/// Record dimension of value at site, and return value.
+/// @tparam F  Type of function that returns site.
+/// @tparam V  Type of value.
+/// @param  f  Function that returns site, constructed on first call.
+/// @param  v  Value.
+template <typename F, typename V> std::decay_t<V> probe(F f, V &&v) {
+  f(v).record(v.d());
+  return std::forward<V>(v);
+}
+
+
+} // namespace impl
+} // namespace units
+} // namespace vnix
+
+
+#ifdef VNIX_UNITS_PROFILE
+/// Record dimension of quantity at this line, and evaluate to quantity.
+#define VNIX_UNITS_SITE(...)                                                   \
+  ::vnix::units::impl::probe(                                                  \
+      [](auto const &v) -> ::vnix::units::site & {                             \
+        static ::vnix::units::site s(__FILE__, __LINE__, v);                   \
+        return s;                                                              \
+      },                                                                       \
+      __VA_ARGS__)
+#else
+#define VNIX_UNITS_SITE(...) (__VA_ARGS__)
+#endif
+
+#endif // ndef VNIX_UNITS_PROFILE_HPP
@@ -0,0 +1,161 @@
+/// @file       vnix/units/quantity-span.hpp
+/// @brief      Definition of vnix::units::statdim_span and dyndim_span.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD Three-Clause; see LICENSE.
+
+#ifndef VNIX_UNITS_QUANTITY_SPAN_HPP
+#define VNIX_UNITS_QUANTITY_SPAN_HPP
+
+#include <cstddef>               // for size_t
+#include <type_traits>           // for remove_const_t
+#include <vnix/units/dimval.hpp> // for basic_statdim, basic_dyndim
+
+namespace vnix {
+namespace units {
+
+
+/// Non-owning view of contiguous numbers that share a dimension known at
+/// compile-time.
+///
+/// Each number is stored in units of the basis.  Because the dimension is a
+/// template parameter, no dimension is stored, and no dimension is checked on
+/// access to an element.
+///
+/// @tparam D  Encoding of dimension in dim::word.
+/// @tparam T  Type of each number (possibly const).
+template <dim::word D, typename T> class statdim_span {
+  T *    data_; ///< Pointer to first number.
+  size_t size_; ///< Number of elements.
+
+public:
+  using number_type = std::remove_const_t<T>; ///< Type of each number.
+
+  /// Type of each element when accessed as dimensioned quantity.
+  using value_type = basic_statdim<D, number_type>;
+
+  /// Initialize from pointer to numbers and from number of numbers.
+  /// @param p  Pointer to first number.
+  /// @param n  Number of elements.
+  constexpr statdim_span(T *p, size_t n) : data_(p), size_(n) {}
+
+  /// Allow implicit conversion from mutable to immutable span.
+  /// @tparam OT  Type of each number in other span.
+  /// @param  s   Other span.
+  template <typename OT>
+  constexpr statdim_span(statdim_span<D, OT> const &s)
+      : data_(s.data()), size_(s.size()) {}
+
+  constexpr static dim d() { return dim(D); } ///< Dimension of every element.
+  constexpr T *        data() const { return data_; } ///< Raw numbers.
+  constexpr size_t     size() const { return size_; } ///< Number of elements.
+  constexpr bool       empty() const { return size_ == 0; } ///< True if empty.
+
+  /// Dimensioned quantity at specified offset.
+  /// @param i  Offset of element.
+  constexpr value_type operator[](size_t i) const {
+    return dimval<number_type, statdim_base<D>>(data_[i], d());
+  }
+
+  /// Replace dimensioned quantity at specified offset.
+  /// This will throw an exception if the dimensions are different.
+  /// @tparam OT  Numeric type of quantity.
+  /// @tparam OB  Base-dimension type of quantity.
+  /// @param  i   Offset of element.
+  /// @param  v   New quantity.
+  template <typename OT, typename OB>
+  void set(size_t i, dimval<OT, OB> const &v) const {
+    statdim_base<D>::comparison(v); // Check for compatibility of units.
+    data_[i] = v.raw_number();
+  }
+
+  /// View of contiguous subset of elements.
+  /// @param off  Offset of first element in subset.
+  /// @param n    Number of elements in subset.
+  constexpr statdim_span subspan(size_t off, size_t n) const {
+    return statdim_span(data_ + off, n);
+  }
+};
+
+
+/// Non-owning view of contiguous numbers that share a dimension known only at
+/// run-time.
+///
+/// Each number is stored in units of the basis.  The dimension is stored once
+/// for the whole span, and so it may be checked once, via as(), in order to
+/// produce a statdim_span.
+///
+/// @tparam T  Type of each number (possibly const).
+template <typename T> class dyndim_span {
+  T *    data_; ///< Pointer to first number.
+  size_t size_; ///< Number of elements.
+  dim    d_;    ///< Dimension shared by every element.
+
+public:
+  using number_type = std::remove_const_t<T>;    ///< Type of each number.
+  using value_type  = basic_dyndim<number_type>; ///< Type of each element.
+
+  /// Initialize from pointer to numbers, number of numbers, and dimension.
+  /// @param p   Pointer to first number.
+  /// @param n   Number of elements.
+  /// @param dd  Dimension shared by every element.
+  constexpr dyndim_span(T *p, size_t n, dim dd) : data_(p), size_(n), d_(dd) {}
+
+  /// Initialize from statically dimensioned span.
+  /// @tparam D   Encoding of dimension in dim::word.
+  /// @tparam OT  Type of each number in other span.
+  /// @param  s   Other span.
+  template <dim::word D, typename OT>
+  constexpr dyndim_span(statdim_span<D, OT> const &s)
+      : data_(s.data()), size_(s.size()), d_(s.d()) {}
+
+  /// Allow implicit conversion from mutable to immutable span.
+  /// @tparam OT  Type of each number in other span.
+  /// @param  s   Other span.
+  template <typename OT>
+  constexpr dyndim_span(dyndim_span<OT> const &s)
+      : data_(s.data()), size_(s.size()), d_(s.d()) {}
+
+  constexpr dim    d() const { return d_; }        ///< Shared dimension.
+  constexpr T *    data() const { return data_; }  ///< Raw numbers.
+  constexpr size_t size() const { return size_; }  ///< Number of elements.
+  constexpr bool   empty() const { return size_ == 0; } ///< True if empty.
+
+  /// Dimensioned quantity at specified offset.
+  /// @param i  Offset of element.
+  constexpr value_type operator[](size_t i) const {
+    return dimval<number_type, dyndim_base>(data_[i], d_);
+  }
+
+  /// Replace dimensioned quantity at specified offset.
+  /// This will throw an exception if the dimensions are different.
+  /// @tparam OT  Numeric type of quantity.
+  /// @tparam OB  Base-dimension type of quantity.
+  /// @param  i   Offset of element.
+  /// @param  v   New quantity.
+  template <typename OT, typename OB>
+  void set(size_t i, dimval<OT, OB> const &v) const {
+    if (v.d() != d_) { error("incompatible dimension for element of span"); }
+    data_[i] = v.raw_number();
+  }
+
+  /// View of contiguous subset of elements.
+  /// @param off  Offset of first element in subset.
+  /// @param n    Number of elements in subset.
+  constexpr dyndim_span subspan(size_t off, size_t n) const {
+    return dyndim_span(data_ + off, n, d_);
+  }
+
+  /// Check dimension once, and produce statically dimensioned span.
+  /// This will throw an exception if the dimensions are different.
+  /// @tparam D  Encoding of dimension in dim::word.
+  template <dim::word D> constexpr statdim_span<D, T> as() const {
+    if (d_ != dim(D)) { error("incompatible dimension for span"); }
+    return statdim_span<D, T>(data_, size_);
+  }
+};
+
+
+} // namespace units
+} // namespace vnix
+
+#endif // ndef VNIX_UNITS_QUANTITY_SPAN_HPP
@@ -0,0 +1,361 @@
+/// @file       vnix/units/registry.hpp
+/// @brief      Definition of vnix::units::unit_registry.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD Three-Clause; see LICENSE.
+
+#ifndef VNIX_UNITS_REGISTRY_HPP
+#define VNIX_UNITS_REGISTRY_HPP
+
+#include <cstdint>                  // for uint32_t
+#include <cstring>                  // for memcpy, memcmp
+#include <fstream>                  // for ifstream
+#include <istream>                  // for istream
+#include <string>                   // for string
+#include <vector>                   // for vector
+#include <vnix/units/unit-expr.hpp> // for parse_unit
+
+namespace vnix {
+namespace units {
+
+
+namespace impl {
+
+
+/// Flat hash-table, with open addressing and linear probing, from short
+/// string to value.
+///
+/// Each key is stored inline in its slot, so that a lookup usually touches a
+/// single cache-line.
+///
+/// @tparam V  Type of value.
+template <typename V> class flat_map {
+public:
+  enum { MAX_KEY = 15 }; ///< Maximum number of characters in key.
+
+private:
+  /// Slot in table.
+  struct slot {
+    char key[MAX_KEY]; ///< Characters of key (not null-terminated).
+    char len;          ///< Number of characters in key; zero if slot empty.
+    V    val;          ///< Value.
+  };
+
+  std::vector<slot> slots_; ///< Power-of-two number of slots.
+  size_t            size_;  ///< Number of occupied slots.
+
+  /// FNV-1a hash of key.
+  /// @param s  Pointer to first character.
+  /// @param n  Number of characters.
+  static uint32_t hash(char const *s, size_t n) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < n; ++i) { h = (h ^ uint8_t(s[i])) * 16777619u; }
+    return h;
+  }
+
+  /// Slot holding key, or first empty slot at which key would be placed.
+  /// @param s  Pointer to first character.
+  /// @param n  Number of characters.
+  size_t probe(char const *s, size_t n) const {
+    size_t const mask = slots_.size() - 1;
+    for (size_t i = hash(s, n) & mask;; i = (i + 1) & mask) {
+      slot const &e = slots_[i];
+      if (e.len == 0) { return i; }
+      if (size_t(e.len) == n && std::memcmp(e.key, s, n) == 0) { return i; }
+    }
+  }
+
+  /// Double number of slots.
+  void grow() {
+    std::vector<slot> old(2 * slots_.size());
+    old.swap(slots_);
+    for (auto &e : slots_) { e.len = 0; }
+    for (auto const &e : old) {
+      if (e.len) { slots_[probe(e.key, e.len)] = e; }
+    }
+  }
+
+public:
+  flat_map() : slots_(16), size_(0) {
+    for (auto &e : slots_) { e.len = 0; }
+  }
+
+  size_t size() const { return size_; } ///< Number of entries.
+
+  /// Insert or replace value for key.
+  /// @param k  Key.
+  /// @param v  Value.
+  void put(std::string const &k, V const &v) {
+    if (k.empty() || k.size() > MAX_KEY) { error("bad length of key"); }
+    if (2 * (size_ + 1) > slots_.size()) { grow(); }
+    slot &e = slots_[probe(k.data(), k.size())];
+    if (e.len == 0) {
+      std::memcpy(e.key, k.data(), k.size());
+      e.len = char(k.size());
+      ++size_;
+    }
+    e.val = v;
+  }
+
+  /// Pointer to value for key, or null pointer if absent.
+  /// @param s  Pointer to first character of key.
+  /// @param n  Number of characters in key.
+  V const *find(char const *s, size_t n) const {
+    if (n == 0 || n > MAX_KEY) { return nullptr; }
+    slot const &e = slots_[probe(s, n)];
+    return e.len ? &e.val : nullptr;
+  }
+};
+
+
+/// Scale-factor for SI prefix, as in units.yml.
+/// @param p  Symbol for prefix (e.g., "k" or "mu").
+inline long double si_prefix(std::string const &p) {
+  struct pfx {
+    char const *sym; ///< Symbol for prefix.
+    long double sf;  ///< Scale-factor.
+  };
+  static pfx const table[] = {
+      {"P", 1.0E+15L}, {"T", 1.0E+12L}, {"G", 1.0E+09L}, {"M", 1.0E+06L},
+      {"k", 1.0E+03L}, {"h", 1.0E+02L}, {"da", 1.0E+01L}, {"d", 1.0E-01L},
+      {"c", 1.0E-02L}, {"m", 1.0E-03L}, {"mu", 1.0E-06L}, {"n", 1.0E-09L},
+      {"p", 1.0E-12L}, {"f", 1.0E-15L}};
+  for (auto const &e : table) {
+    if (p == e.sym) { return e.sf; }
+  }
+  error("illegal symbol for prefix");
+  return 1;
+}
+
+
+/// Remove leading and trailing blanks.
+/// @param s  Input string.
+inline std::string trim(std::string const &s) {
+  size_t const b = s.find_first_not_of(" \t\r");
+  if (b == std::string::npos) { return ""; }
+  size_t const e = s.find_last_not_of(" \t\r");
+  return s.substr(b, e - b + 1);
+}
+
+
+/// Parse YAML flow-mapping such as "{dim: length, sym: m, scales: [k,M]}".
+///
+/// Only the subset of YAML used by units.yml is supported: plain scalars and
+/// flow-sequences of plain scalars.
+///
+/// @param s  Text of flow-mapping, including braces.
+/// @return   Key and value for each entry; a sequence is returned with its
+///           brackets, and without blanks.
+inline std::vector<std::pair<std::string, std::string>>
+flow_map(std::string const &s) {
+  std::string const t = trim(s);
+  if (t.size() < 2 || t.front() != '{' || t.back() != '}') {
+    error("expected flow-mapping in YAML");
+  }
+  std::vector<std::pair<std::string, std::string>> kv;
+  std::string                                      item;
+  int                                              depth = 0;
+  auto                                             flush = [&] {
+    size_t const c = item.find(':');
+    if (c == std::string::npos) { error("expected ':' in YAML"); }
+    kv.emplace_back(trim(item.substr(0, c)), trim(item.substr(c + 1)));
+    item.clear();
+  };
+  for (size_t i = 1; i + 1 < t.size(); ++i) {
+    char const c = t[i];
+    if (c == '[') { ++depth; }
+    if (c == ']') { --depth; }
+    if (c == ',' && depth == 0) {
+      flush();
+    } else if (!(depth && (c == ' ' || c == '\t'))) {
+      item += c;
+    }
+  }
+  if (!trim(item).empty()) { flush(); }
+  return kv;
+}
+
+
+/// Parse flow-sequence such as "[c,m,mu]".
+/// @param s  Text of flow-sequence, including brackets.
+inline std::vector<std::string> flow_seq(std::string const &s) {
+  if (s.size() < 2 || s.front() != '[' || s.back() != ']') {
+    error("expected flow-sequence in YAML");
+  }
+  std::vector<std::string> v;
+  size_t                   b = 1;
+  while (b < s.size() - 1) {
+    size_t e = s.find(',', b);
+    if (e == std::string::npos || e > s.size() - 1) { e = s.size() - 1; }
+    std::string const x = trim(s.substr(b, e - b));
+    if (!x.empty()) { v.push_back(x); }
+    b = e + 1;
+  }
+  return v;
+}
+
+
+} // namespace impl
+
+
+/// Registry of units and dimensions, loaded at run-time from text in the
+/// format of units.yml.
+///
+/// Whereas units.yml is otherwise consumed at build-time by process-template,
+/// unit_registry allows a unit to be added without recompiling.  The basis in
+/// the file must match the basis compiled into vnix::units::dim, but scaled
+/// units, derived units, and named dimensions may differ.
+///
+/// Each symbol maps to a scale-factor and a dimension in a flat hash-table,
+/// for use by parsers, converters, and formatters.
+class unit_registry {
+  impl::flat_map<unit_spec> units_; ///< Unit for each symbol.
+  impl::flat_map<dim>       dims_;  ///< Dimension for each name.
+
+  /// Function-object that looks up symbol in registry for parse_unit().
+  struct lookup {
+    unit_registry const &r; ///< Registry.
+
+    /// Find unit for symbol, or throw if there be none.
+    /// @param s  Pointer to first character of symbol.
+    /// @param n  Number of characters in symbol.
+    unit_spec operator()(char const *s, size_t n) const {
+      unit_spec const *u = r.units_.find(s, n);
+      if (!u) { error("unknown symbol for unit"); }
+      return *u;
+    }
+  };
+
+  /// Register unit and each of its scaled versions.
+  /// @param sym     Symbol for unit.
+  /// @param u       Scale-factor and dimension of unit.
+  /// @param scales  Sequence of prefixes, as in "[k,M]".
+  void add(std::string const &sym, unit_spec const &u,
+           std::string const &scales) {
+    units_.put(sym, u);
+    if (scales.empty()) { return; }
+    for (auto const &p : impl::flow_seq(scales)) {
+      units_.put(p + sym, {impl::si_prefix(p) * u.sf, u.d});
+    }
+  }
+
+  /// Value of key in flow-mapping, or empty string if absent.
+  /// @param kv  Keys and values.
+  /// @param k   Key.
+  static std::string
+  value(std::vector<std::pair<std::string, std::string>> const &kv,
+        char const *                                             k) {
+    for (auto const &e : kv) {
+      if (e.first == k) { return e.second; }
+    }
+    return "";
+  }
+
+public:
+  /// Load registry from text in the format of units.yml.
+  ///
+  /// This will throw an exception if the text be malformed, if its basis or
+  /// its bits for exponent differ from those compiled, or if an expression
+  /// refer to an unknown symbol.
+  ///
+  /// @param is  Input stream.
+  explicit unit_registry(std::istream &is) {
+    enum { NONE, BASIS, UNITS, DIMS } section = NONE;
+    unsigned    nbasis                        = 0;
+    std::string line;
+    while (std::getline(is, line)) {
+      size_t const hash = line.find('#');
+      if (hash != std::string::npos) { line.erase(hash); }
+      std::string const t = impl::trim(line);
+      if (t.empty() || t == "---") { continue; }
+      if (t.back() == ':') {
+        if (t == "basis:") {
+          section = BASIS;
+        } else if (t == "units:") {
+          section = UNITS;
+        } else if (t == "dims:") {
+          section = DIMS;
+        } else {
+          section = NONE;
+        }
+        continue;
+      }
+      if (t.compare(0, 9, "exponent:") == 0) {
+        auto const        kv = impl::flow_map(t.substr(9));
+        std::string const n  = value(kv, "numerator-bits");
+        std::string const d  = value(kv, "denominator-bits");
+        if ((!n.empty() && std::stoul(n) != dim::off::nmr_bits) ||
+            (!d.empty() && std::stoul(d) != dim::off::dnm_bits)) {
+          error("exponent in registry differs from compiled exponent");
+        }
+        continue;
+      }
+      if (t[0] != '-') { error("expected sequence-entry in YAML"); }
+      std::string const item = impl::trim(t.substr(1));
+      if (section == BASIS) {
+        auto const kv = impl::flow_map(item);
+        if (nbasis >= dim::NUM_BASES) { error("too many bases in registry"); }
+        std::string const sym = value(kv, "sym");
+        if (sym != dim::off::sym[nbasis]) {
+          error("basis in registry differs from compiled basis");
+        }
+        dim d;
+        d.set(dim::off::array[nbasis++], 1);
+        add(sym, {1, d}, value(kv, "scales"));
+        dims_.put(value(kv, "dim"), d);
+      } else if (section == UNITS) {
+        if (nbasis != dim::NUM_BASES) { error("incomplete basis in registry"); }
+        auto const        kv = impl::flow_map(item);
+        std::string const s  = value(kv, "sym");
+        size_t const      eq = s.find('=');
+        if (eq == std::string::npos) { error("expected '=' in derived unit"); }
+        std::string const sym = impl::trim(s.substr(0, eq));
+        add(sym, unit(s.substr(eq + 1)), value(kv, "scales"));
+      } else if (section == DIMS) {
+        size_t const eq = item.find('=');
+        if (eq == std::string::npos) { error("expected '=' in derived dim"); }
+        std::string e  = impl::trim(item.substr(eq + 1));
+        size_t const b = e.find('(');
+        if (b != std::string::npos && e.back() == ')') {
+          e = e.substr(b + 1, e.size() - b - 2); // Strip "decltype(...)".
+        }
+        dims_.put(impl::trim(item.substr(0, eq)), unit(e).d);
+      }
+    }
+    if (nbasis != dim::NUM_BASES) { error("incomplete basis in registry"); }
+  }
+
+  /// Load registry from file in the format of units.yml.
+  /// @param path  Name of file.
+  static unit_registry load(std::string const &path) {
+    std::ifstream is(path);
+    if (!is) { error("cannot open file for registry"); }
+    return unit_registry(is);
+  }
+
+  size_t num_units() const { return units_.size(); } ///< Number of units.
+  size_t num_dims() const { return dims_.size(); }   ///< Number of dims.
+
+  /// Pointer to unit for symbol, or null pointer if absent.
+  /// @param sym  Symbol, such as "km".
+  unit_spec const *find_unit(std::string const &sym) const {
+    return units_.find(sym.data(), sym.size());
+  }
+
+  /// Pointer to dimension for name, or null pointer if absent.
+  /// @param name  Name of dimension, such as "speed".
+  dim const *find_dim(std::string const &name) const {
+    return dims_.find(name.data(), name.size());
+  }
+
+  /// Parse expression of unit, looking up each symbol in the registry.
+  /// @param expr  Expression, such as "km/s".
+  unit_spec unit(std::string const &expr) const {
+    return parse_unit(expr, lookup{*this});
+  }
+};
+
+
+} // namespace units
+} // namespace vnix
+
+#endif // ndef VNIX_UNITS_REGISTRY_HPP
@@ -0,0 +1,75 @@
+/// @file       vnix/units/soa-kernel.hpp
+/// @brief      Definition of vnix::units::impl::soa_apply.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD Three-Clause; see LICENSE.
+
+#ifndef VNIX_UNITS_SOA_KERNEL_HPP
+#define VNIX_UNITS_SOA_KERNEL_HPP
+
+#include <cstddef> // for size_t
+
+namespace vnix {
+namespace units {
+namespace impl {
+
+
+enum : size_t { SOA_BLOCK = 64 }; ///< Elements processed at once.
+
+
+/// Apply f to corresponding elements of two operands, each of which is
+/// stored as a structure of two arrays, such as an estimate and an
+/// uncertainty, or a lower and an upper bound.
+///
+/// Each block is copied into local arrays, which the compiler knows not to
+/// alias, and the loop over the block has a fixed count, so that the
+/// compiler can vectorize f even at -O2 (with -fno-math-errno if f call
+/// std::sqrt).  A partial block is padded with copies of its first element,
+/// so that f never sees a number that is not in an operand.  Because each
+/// block is copied before the result is stored, the result may overwrite
+/// either operand.
+///
+/// @tparam T   Type of number.
+/// @tparam F   Type of function(a0, a1, b0, b1, o0, o1).
+/// @param  a0  First array of left-hand operand.
+/// @param  a1  Second array of left-hand operand.
+/// @param  b0  First array of right-hand operand.
+/// @param  b1  Second array of right-hand operand.
+/// @param  o0  First array of result.
+/// @param  o1  Second array of result.
+/// @param  n   Number of elements.
+/// @param  f   Operation on one element.
+template <typename T, typename F>
+void soa_apply(T const *a0, T const *a1, T const *b0, T const *b1, T *o0,
+               T *o1, size_t n, F f) {
+  T la0[SOA_BLOCK], la1[SOA_BLOCK], lb0[SOA_BLOCK], lb1[SOA_BLOCK];
+  T lo0[SOA_BLOCK], lo1[SOA_BLOCK];
+  for (size_t b = 0; b < n; b += SOA_BLOCK) {
+    size_t const m = (n - b < SOA_BLOCK ? n - b : size_t(SOA_BLOCK));
+    for (size_t i = 0; i < m; ++i) {
+      la0[i] = a0[b + i];
+      la1[i] = a1[b + i];
+      lb0[i] = b0[b + i];
+      lb1[i] = b1[b + i];
+    }
+    for (size_t i = m; i < SOA_BLOCK; ++i) {
+      la0[i] = la0[0];
+      la1[i] = la1[0];
+      lb0[i] = lb0[0];
+      lb1[i] = lb1[0];
+    }
+    for (size_t i = 0; i < SOA_BLOCK; ++i) {
+      f(la0[i], la1[i], lb0[i], lb1[i], lo0[i], lo1[i]);
+    }
+    for (size_t i = 0; i < m; ++i) {
+      o0[b + i] = lo0[i];
+      o1[b + i] = lo1[i];
+    }
+  }
+}
+
+
+} // namespace impl
+} // namespace units
+} // namespace vnix
+
+#endif // ndef VNIX_UNITS_SOA_KERNEL_HPP
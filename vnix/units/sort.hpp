@@ -0,0 +1,421 @@
+/// @file       vnix/units/sort.hpp
+/// @brief      Sorting, selection, and partitioning of spans of quantities.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD Three-Clause; see LICENSE.
+
+#ifndef VNIX_UNITS_SORT_HPP
+#define VNIX_UNITS_SORT_HPP
+
+#include <algorithm>                    // for sort, nth_element, etc.
+#include <array>                        // for array
+#include <cstdint>                      // for uint32_t, uint64_t
+#include <cstring>                      // for memcpy
+#include <functional>                   // for greater
+#include <limits>                       // for numeric_limits
+#include <thread>                       // for thread
+#include <type_traits>                  // for integral_constant
+#include <vector>                       // for vector
+#include <vnix/units/quantity-span.hpp> // for statdim_span, dyndim_span
+
+namespace vnix {
+namespace units {
+
+
+namespace impl {
+
+
+/// Unsigned integer with same size as floating-point type, or void if there
+/// be no radix-sort for the type.
+/// @tparam T  Type of number.
+template <typename T> struct radix_word { using type = void; };
+
+/// Unsigned integer with same size as float.
+template <> struct radix_word<float> { using type = uint32_t; };
+
+/// Unsigned integer with same size as double.
+template <> struct radix_word<double> { using type = uint64_t; };
+
+
+/// True if numbers of type T be sorted by radix.
+/// @tparam T  Type of number.
+template <typename T>
+using has_radix = std::integral_constant<
+    bool, std::numeric_limits<T>::is_iec559 &&
+              !std::is_void<typename radix_word<T>::type>::value>;
+
+
+/// Key whose unsigned order is the order of the IEEE-754 number.
+///
+/// The sign-bit of a non-negative number is set; every bit of a negative
+/// number is flipped.  Negative zero precedes positive zero, and a NaN sorts
+/// after infinity of the same sign.
+///
+/// @tparam U  Type of unsigned word.
+/// @tparam T  Type of floating-point number.
+/// @param  x  Number.
+template <typename U, typename T> U radix_key(T x) {
+  enum { SIGN = 8 * sizeof(U) - 1 };
+  U u;
+  std::memcpy(&u, &x, sizeof(u));
+  return (u >> SIGN) ? ~u : (u | (U(1) << SIGN));
+}
+
+
+/// Number from key produced by radix_key().
+/// @tparam T  Type of floating-point number.
+/// @tparam U  Type of unsigned word.
+/// @param  k  Key.
+template <typename T, typename U> T radix_num(U k) {
+  enum { SIGN = 8 * sizeof(U) - 1 };
+  U const u = (k >> SIGN) ? (k ^ (U(1) << SIGN)) : ~k;
+  T       x;
+  std::memcpy(&x, &u, sizeof(x));
+  return x;
+}
+
+
+/// Stable least-significant-digit radix-sort of keys, with eleven-bit digits.
+///
+/// A histogram for every digit is built in a single pass, and each pass of
+/// scattering is skipped when every key has the same digit.  The payload, if
+/// not null, is permuted alongside the keys.
+///
+/// @tparam U  Type of unsigned key.
+/// @tparam P  Type of payload.
+/// @param  k  Keys.
+/// @param  p  Payload, or null pointer.
+/// @param  n  Number of keys.
+template <typename U, typename P> void radix_sort(U *k, P *p, size_t n) {
+  enum {
+    BITS   = 11,                               // Bits per digit.
+    RADIX  = 1 << BITS,                        // Buckets per digit.
+    DIGITS = (8 * sizeof(U) + BITS - 1) / BITS // Digits per key.
+  };
+  std::vector<std::array<size_t, RADIX>> hist(DIGITS);
+  for (auto &h : hist) { h.fill(0); }
+  for (size_t i = 0; i < n; ++i) {
+    for (unsigned d = 0; d < DIGITS; ++d) {
+      ++hist[d][(k[i] >> BITS * d) & (RADIX - 1)];
+    }
+  }
+  std::vector<U> kb(n);
+  std::vector<P> pb(p ? n : 0);
+  U *            ks = k;
+  P *            ps = p;
+  U *            kd = kb.data();
+  P *            pd = pb.data();
+  for (unsigned d = 0; d < DIGITS; ++d) {
+    auto &h = hist[d];
+    if (h[(ks[0] >> BITS * d) & (RADIX - 1)] == n) { continue; } // All same.
+    size_t sum = 0;
+    for (auto &c : h) {
+      size_t const t = c;
+      c              = sum;
+      sum += t;
+    }
+    for (size_t i = 0; i < n; ++i) {
+      size_t const j = h[(ks[i] >> BITS * d) & (RADIX - 1)]++;
+      kd[j]          = ks[i];
+      if (p) { pd[j] = ps[i]; }
+    }
+    std::swap(ks, kd);
+    std::swap(ps, pd);
+  }
+  if (ks != k) {
+    std::copy(ks, ks + n, k);
+    if (p) { std::copy(ps, ps + n, p); }
+  }
+}
+
+
+/// Sort numbers by radix.
+/// @tparam T  Type of number.
+/// @param  x  Pointer to first number.
+/// @param  n  Number of numbers.
+template <typename T> void sort(T *x, size_t n, std::true_type) {
+  using U = typename radix_word<T>::type;
+  if (n < 4096) { return std::sort(x, x + n); } // Histograms would dominate.
+  std::vector<U> k(n);
+  for (size_t i = 0; i < n; ++i) { k[i] = radix_key<U>(x[i]); }
+  radix_sort(k.data(), (char *)nullptr, n);
+  for (size_t i = 0; i < n; ++i) { x[i] = radix_num<T>(k[i]); }
+}
+
+
+/// Sort numbers by comparison, for type without radix-sort.
+/// @tparam T  Type of number.
+/// @param  x  Pointer to first number.
+/// @param  n  Number of numbers.
+template <typename T> void sort(T *x, size_t n, std::false_type) {
+  std::sort(x, x + n);
+}
+
+
+/// Permutation that would stably sort numbers, by radix.
+/// @tparam T  Type of number.
+/// @param  x  Pointer to first number.
+/// @param  n  Number of numbers.
+template <typename T>
+std::vector<size_t> sort_order(T const *x, size_t n, std::true_type) {
+  using U = typename radix_word<T>::type;
+  std::vector<U>      k(n);
+  std::vector<size_t> o(n);
+  for (size_t i = 0; i < n; ++i) {
+    k[i] = radix_key<U>(x[i]);
+    o[i] = i;
+  }
+  if (n) { radix_sort(k.data(), o.data(), n); }
+  return o;
+}
+
+
+/// Permutation that would stably sort numbers, by comparison.
+/// @tparam T  Type of number.
+/// @param  x  Pointer to first number.
+/// @param  n  Number of numbers.
+template <typename T>
+std::vector<size_t> sort_order(T const *x, size_t n, std::false_type) {
+  std::vector<size_t> o(n);
+  for (size_t i = 0; i < n; ++i) { o[i] = i; }
+  std::stable_sort(o.begin(), o.end(),
+                   [x](size_t a, size_t b) { return x[a] < x[b]; });
+  return o;
+}
+
+
+/// Sort numbers in parallel chunks, and merge chunks pairwise in parallel.
+/// @tparam T        Type of number.
+/// @param  x        Pointer to first number.
+/// @param  n        Number of numbers.
+/// @param  threads  Maximum number of threads.
+template <typename T> void parallel_sort(T *x, size_t n, unsigned threads) {
+  if (threads < 2 || n < (size_t(1) << 16)) {
+    return impl::sort(x, n, has_radix<T>());
+  }
+  size_t const             chunk = (n + threads - 1) / threads;
+  std::vector<size_t>      bound; // Offset of each chunk, plus end.
+  std::vector<std::thread> pool;
+  for (size_t b = 0; b < n; b += chunk) { bound.push_back(b); }
+  bound.push_back(n);
+  for (size_t c = 0; c + 1 < bound.size(); ++c) {
+    T *const     p = x + bound[c];
+    size_t const m = bound[c + 1] - bound[c];
+    pool.emplace_back([p, m] { impl::sort(p, m, has_radix<T>()); });
+  }
+  for (auto &t : pool) { t.join(); }
+  std::vector<T> buf(n);
+  T *            src = x;
+  T *            dst = buf.data();
+  while (bound.size() > 2) {
+    std::vector<size_t> next;
+    pool.clear();
+    for (size_t c = 0; c + 1 < bound.size(); c += 2) {
+      size_t const b = bound[c], m = bound[c + 1];
+      size_t const e = (c + 2 < bound.size() ? bound[c + 2] : m);
+      next.push_back(b);
+      pool.emplace_back([=] {
+        std::merge(src + b, src + m, src + m, src + e, dst + b);
+      });
+    }
+    next.push_back(n);
+    for (auto &t : pool) { t.join(); }
+    bound.swap(next);
+    std::swap(src, dst);
+  }
+  if (src != x) { std::copy(src, src + n, x); }
+}
+
+
+/// Check that dimension of quantity matches that of span.
+/// @tparam S  Type of span.
+/// @tparam T  Numeric type of quantity.
+/// @tparam B  Base-dimension type of quantity.
+/// @param  s  Span.
+/// @param  v  Quantity.
+template <typename S, typename T, typename B>
+void check_dim(S const &s, dimval<T, B> const &v) {
+  if (s.d() != v.d()) { error("incompatible dimensions for comparison"); }
+}
+
+
+} // namespace impl
+
+
+/// Sort quantities in span into ascending order.
+///
+/// No dimension is checked, because every element of a span shares a
+/// dimension.  Numbers of type float or double are sorted by radix on the
+/// bits of their IEEE-754 representation; in that order, -0 precedes +0.
+///
+/// @tparam D  Encoding of dimension.
+/// @tparam T  Type of number.
+/// @param  s  Span.
+template <dim::word D, typename T> void sort(statdim_span<D, T> const &s) {
+  impl::sort(s.data(), s.size(), impl::has_radix<T>());
+}
+
+
+/// Sort quantities in span into ascending order.
+/// @tparam T  Type of number.
+/// @param  s  Span.
+template <typename T> void sort(dyndim_span<T> const &s) {
+  impl::sort(s.data(), s.size(), impl::has_radix<T>());
+}
+
+
+/// Sort quantities in span into ascending order by multiple threads.
+/// Small spans are sorted by a single thread.
+/// @tparam T        Type of number.
+/// @param  s        Span.
+/// @param  threads  Maximum number of threads.
+template <typename T>
+void parallel_sort(dyndim_span<T> const &s,
+                   unsigned threads = std::thread::hardware_concurrency()) {
+  impl::parallel_sort(s.data(), s.size(), threads);
+}
+
+
+/// Sort quantities in span into ascending order by multiple threads.
+/// @tparam D        Encoding of dimension.
+/// @tparam T        Type of number.
+/// @param  s        Span.
+/// @param  threads  Maximum number of threads.
+template <dim::word D, typename T>
+void parallel_sort(statdim_span<D, T> const &s,
+                   unsigned threads = std::thread::hardware_concurrency()) {
+  impl::parallel_sort(s.data(), s.size(), threads);
+}
+
+
+/// Permutation that would stably sort quantities in span, such as might be
+/// used to reorder the rows of a table by one of its columns.
+/// @tparam T  Type of number.
+/// @param  s  Span.
+/// @return    Offset in span of each quantity in sorted order.
+template <typename T> std::vector<size_t> sort_order(dyndim_span<T> const &s) {
+  using N = std::remove_const_t<T>;
+  return impl::sort_order(s.data(), s.size(), impl::has_radix<N>());
+}
+
+
+/// Rearrange quantities so that the nth is where it would be if sorted, with
+/// no larger quantity before it and no smaller quantity after it.
+/// @tparam T  Type of number.
+/// @param  s  Span.
+/// @param  n  Offset of quantity.
+template <typename T> void nth_element(dyndim_span<T> const &s, size_t n) {
+  std::nth_element(s.data(), s.data() + n, s.data() + s.size());
+}
+
+
+/// Rearrange quantities so that those less than pivot come first.
+/// This will throw an exception if the dimension of the pivot differ from that
+/// of the span; the dimension is checked only once.
+/// @tparam T   Type of number in span.
+/// @tparam OT  Type of number in pivot.
+/// @tparam OB  Base-dimension type of pivot.
+/// @param  s   Span.
+/// @param  v   Pivot.
+/// @return     Number of quantities less than pivot.
+template <typename T, typename OT, typename OB>
+size_t partition(dyndim_span<T> const &s, dimval<OT, OB> const &v) {
+  impl::check_dim(s, v);
+  T const p = v.raw_number();
+  T *const e =
+      std::partition(s.data(), s.data() + s.size(), [p](T x) { return x < p; });
+  return e - s.data();
+}
+
+
+/// Move k largest quantities to front of span, in descending order.
+/// @tparam T  Type of number.
+/// @param  s  Span.
+/// @param  k  Number of quantities.
+/// @return    View of k largest quantities.
+template <typename T>
+dyndim_span<T> top_k(dyndim_span<T> const &s, size_t k) {
+  if (k > s.size()) { k = s.size(); }
+  std::partial_sort(s.data(), s.data() + k, s.data() + s.size(),
+                    std::greater<T>());
+  return s.subspan(0, k);
+}
+
+
+/// Permutation that would stably sort quantities in span.
+/// @tparam D  Encoding of dimension.
+/// @tparam T  Type of number.
+/// @param  s  Span.
+/// @return    Offset in span of each quantity in sorted order.
+template <dim::word D, typename T>
+std::vector<size_t> sort_order(statdim_span<D, T> const &s) {
+  return sort_order(dyndim_span<T>(s));
+}
+
+
+/// Rearrange quantities so that the nth is where it would be if sorted.
+/// @tparam D  Encoding of dimension.
+/// @tparam T  Type of number.
+/// @param  s  Span.
+/// @param  n  Offset of quantity.
+template <dim::word D, typename T>
+void nth_element(statdim_span<D, T> const &s, size_t n) {
+  nth_element(dyndim_span<T>(s), n);
+}
+
+
+/// Rearrange quantities so that those less than pivot come first.
+/// This will throw an exception if the dimension of the pivot differ from that
+/// of the span.
+/// @tparam D   Encoding of dimension.
+/// @tparam T   Type of number in span.
+/// @tparam OT  Type of number in pivot.
+/// @tparam OB  Base-dimension type of pivot.
+/// @param  s   Span.
+/// @param  v   Pivot.
+/// @return     Number of quantities less than pivot.
+template <dim::word D, typename T, typename OT, typename OB>
+size_t partition(statdim_span<D, T> const &s, dimval<OT, OB> const &v) {
+  return partition(dyndim_span<T>(s), v);
+}
+
+
+/// Move k largest quantities to front of span, in descending order.
+/// @tparam D  Encoding of dimension.
+/// @tparam T  Type of number.
+/// @param  s  Span.
+/// @param  k  Number of quantities.
+/// @return    View of k largest quantities.
+template <dim::word D, typename T>
+statdim_span<D, T> top_k(statdim_span<D, T> const &s, size_t k) {
+  return top_k(dyndim_span<T>(s), k).template as<D>();
+}
+
+
+/// Sort vector of quantities, which must share a dimension, into ascending
+/// order.
+///
+/// Whereas std::sort would compare dimensions on every comparison, this checks
+/// the dimensions once and then sorts the bare numbers.  This will throw an
+/// exception if the dimensions differ.
+///
+/// @tparam T  Type of number.
+/// @param  v  Quantities.
+template <typename T> void sort(std::vector<basic_dyndim<T>> &v) {
+  if (v.empty()) { return; }
+  dim const      d = v[0].d();
+  std::vector<T> x(v.size());
+  for (size_t i = 0; i < v.size(); ++i) {
+    if (v[i].d() != d) { error("incompatible dimensions for comparison"); }
+    x[i] = v[i].raw_number();
+  }
+  impl::sort(x.data(), x.size(), impl::has_radix<T>());
+  for (size_t i = 0; i < v.size(); ++i) {
+    v[i] = dimval<T, dyndim_base>(x[i], d);
+  }
+}
+
+
+} // namespace units
+} // namespace vnix
+
+#endif // ndef VNIX_UNITS_SORT_HPP
@@ -29,44 +29,57 @@ class dyndim_base;
 template <dim::word D> struct statdim_base {
   /// Check for compatibility on contruction from dim.
   /// @param dd  Candidate dimension.
-  constexpr statdim_base(dim dd) {
+  VNIX_UNITS_INLINE constexpr statdim_base(dim dd) {
+    // Not counted as check.  An operator of dimval passes the statdim_base of
+    // its result directly and so does not come here.
     if (d() != dd) {
-      throw "attempt to construct from incompatible dimension";
+      VNIX_UNITS_COUNT(mismatch);
+      VNIX_UNITS_COUNT(throws);
+      error("attempt to construct from incompatible dimension");
     }
   }
 
-  constexpr statdim_base() {} ///< Allow default construction.
+  /// Allow default construction.
+  VNIX_UNITS_INLINE constexpr statdim_base() {}
 
   /// Exponent for each unit in dimensioned quantity.
-  constexpr static dim d() { return dim(D); }
+  VNIX_UNITS_INLINE constexpr static dim d() { return dim(D); }
 
   /// Throw if dimension be non-null.
-  constexpr static void number() {
-    if (d() != nul_dim) { throw "dimensioned quantity is not a number"; }
+  VNIX_UNITS_INLINE constexpr static void number() {
+    if (d() != nul_dim) {
+      VNIX_UNITS_COUNT(throws);
+      error("dimensioned quantity is not a number");
+    }
   }
 
   /// Test for comparison of dimensioned values.
-  constexpr static void comparison(statdim_base) {}
+  VNIX_UNITS_INLINE constexpr static void comparison(statdim_base) {}
 
   /// Test for comparison of dimensioned values.
-  constexpr static void comparison(dyndim_base const &db);
+  VNIX_UNITS_INLINE constexpr static void comparison(dyndim_base const &db);
 
   /// Dimension for sum of dimensioned values.
-  constexpr static auto sum(statdim_base) { return statdim_base(); }
+  VNIX_UNITS_INLINE constexpr static auto sum(statdim_base) {
+    return statdim_base();
+  }
 
   /// Dimension for sum of dimensioned values.
-  constexpr static dyndim_base sum(dyndim_base const &db);
+  VNIX_UNITS_INLINE constexpr static dyndim_base sum(dyndim_base const &db);
 
   /// Dimension for difference of dimensioned values.
-  constexpr static auto diff(statdim_base) { return statdim_base(); }
+  VNIX_UNITS_INLINE constexpr static auto diff(statdim_base) {
+    return statdim_base();
+  }
 
   /// Dimension for difference of dimensioned values.
-  constexpr static dyndim_base diff(dyndim_base const &db);
+  VNIX_UNITS_INLINE constexpr static dyndim_base diff(dyndim_base const &db);
 
   /// Dimension for product of dimensioned values.
   /// @tparam OD  Encoding of factor's dimension in dim::word.
   /// @return     Dimension of product.
-  template <dim::word OD> constexpr static auto prod(statdim_base<OD>) {
+  template <dim::word OD>
+  VNIX_UNITS_INLINE constexpr static auto prod(statdim_base<OD>) {
     dim::word constexpr rd = (d() + dim(OD)).encode();
     return statdim_base<rd>();
   }
@@ -74,12 +87,13 @@ template <dim::word D> struct statdim_base {
   /// Dimension for product of dimensioned values.
   /// @param db  Factor's dimension.
   /// @return    Dimension of product.
-  constexpr static dyndim_base prod(dyndim_base const &db);
+  VNIX_UNITS_INLINE constexpr static dyndim_base prod(dyndim_base const &db);
 
   /// Dimension for quotient of dimensioned values.
   /// @tparam D  Encoding of divisor's dimension in dim::word.
   /// @return    Dimension of quotient.
-  template <dim::word OD> constexpr static auto quot(statdim_base<OD>) {
+  template <dim::word OD>
+  VNIX_UNITS_INLINE constexpr static auto quot(statdim_base<OD>) {
     dim::word constexpr rd = (d() - dim(OD)).encode();
     return statdim_base<rd>();
   }
@@ -87,7 +101,7 @@ template <dim::word D> struct statdim_base {
   /// Dimension for quotient of dimensioned values.
   /// @param db  Divisor's dimension.
   /// @return    Dimension of quotient.
-  constexpr static dyndim_base quot(dyndim_base const &db);
+  VNIX_UNITS_INLINE constexpr static dyndim_base quot(dyndim_base const &db);
 
   /// Dimensions corresponding to reciprocal of dimensioned quantity.
   constexpr static auto recip_dim = nul_dim - d();
@@ -97,13 +111,16 @@ template <dim::word D> struct statdim_base {
 
   /// Dimension for reciprocal of dimensioned value.
   /// @return  Dimension of reciprocal.
-  constexpr static recip_basedim recip() { return recip_basedim(); }
+  VNIX_UNITS_INLINE constexpr static recip_basedim recip() {
+    return recip_basedim();
+  }
 
   /// Dimension for rational power of dimensioned value.
   /// @tparam PN  Numerator   of power.
   /// @tparam PD  Denominator of power.
   /// @return     Dimension   of result.
-  template <int64_t PN, int64_t PD = 1> constexpr static auto pow() {
+  template <int64_t PN, int64_t PD = 1>
+  VNIX_UNITS_INLINE constexpr static auto pow() {
     dim::word constexpr rd = (d() * dim::rat(PN, PD)).encode();
     return statdim_base<rd>();
   }
@@ -111,11 +128,11 @@ template <dim::word D> struct statdim_base {
   /// Dimension for rational power of dimensioned value.
   /// @param  p  Rational power.
   /// @return    Dimension of result.
-  constexpr static dyndim_base pow(dim::rat p);
+  VNIX_UNITS_INLINE constexpr static dyndim_base pow(dim::rat p);
 
   /// Dimension for square-root of dimensioned value.
   /// @return  Dimension of square-root.
-  constexpr static auto sqrt() {
+  VNIX_UNITS_INLINE constexpr static auto sqrt() {
     dim::word constexpr rd = (d() / dim::rat(2)).encode();
     return statdim_base<rd>();
   }
@@ -135,43 +152,65 @@ namespace units {
 
 // Test for comparison of dimensioned values.
 template <dim::word D>
-constexpr void statdim_base<D>::comparison(dyndim_base const &db) {
-  if (d() != db.d()) { throw "incompatible dimensions for comparison"; }
+VNIX_UNITS_INLINE constexpr void
+statdim_base<D>::comparison(dyndim_base const &db) {
+  VNIX_UNITS_COUNT(check);
+  if (d() != db.d()) {
+    VNIX_UNITS_COUNT(mismatch);
+    VNIX_UNITS_COUNT(throws);
+    error("incompatible dimensions for comparison");
+  }
 }
 
 
 // Dimension for sum of dimensioned values.
 template <dim::word D>
-constexpr dyndim_base statdim_base<D>::sum(dyndim_base const &db) {
-  if (d() != db.d()) { throw "incompatible dimensions for addition"; }
+VNIX_UNITS_INLINE constexpr dyndim_base
+statdim_base<D>::sum(dyndim_base const &db) {
+  VNIX_UNITS_COUNT(check);
+  if (d() != db.d()) {
+    VNIX_UNITS_COUNT(mismatch);
+    VNIX_UNITS_COUNT(throws);
+    error("incompatible dimensions for addition");
+  }
   return d();
 }
 
 
 // Dimension for difference of dimensioned values.
 template <dim::word D>
-constexpr dyndim_base statdim_base<D>::diff(dyndim_base const &db) {
-  if (d() != db.d()) { throw "incompatible dimensions for subtraction"; }
+VNIX_UNITS_INLINE constexpr dyndim_base
+statdim_base<D>::diff(dyndim_base const &db) {
+  VNIX_UNITS_COUNT(check);
+  if (d() != db.d()) {
+    VNIX_UNITS_COUNT(mismatch);
+    VNIX_UNITS_COUNT(throws);
+    error("incompatible dimensions for subtraction");
+  }
   return d();
 }
 
 
 // Dimension for product of dimensioned values.
 template <dim::word D>
-constexpr dyndim_base statdim_base<D>::prod(dyndim_base const &db) {
+VNIX_UNITS_INLINE constexpr dyndim_base
+statdim_base<D>::prod(dyndim_base const &db) {
   return d() + db.d();
 }
 
 
 // Dimension for quotient of dimensioned values.
 template <dim::word D>
-constexpr dyndim_base statdim_base<D>::quot(dyndim_base const &db) {
+VNIX_UNITS_INLINE constexpr dyndim_base
+statdim_base<D>::quot(dyndim_base const &db) {
   return d() - db.d();
 }
 
 
 // Dimension for rational power of dimensioned value.
-template <dim::word D> constexpr dyndim_base statdim_base<D>::pow(dim::rat p) {
+template <dim::word D>
+VNIX_UNITS_INLINE constexpr dyndim_base statdim_base<D>::pow(dim::rat p) {
+  VNIX_UNITS_COUNT(power);
   return d() * p;
 }
 
@@ -0,0 +1,335 @@
+/// @file       vnix/units/state.hpp
+/// @brief      Definition of vnix::units::basic_state_vec and basic_state_mat.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD Three-Clause; see LICENSE.
+
+#ifndef VNIX_UNITS_STATE_HPP
+#define VNIX_UNITS_STATE_HPP
+
+#include <type_traits>           // for decay_t, is_same
+#include <utility>               // for declval
+#include <vnix/mv/mat.hpp>       // for mat
+#include <vnix/units/dimval.hpp> // for basic_statdim, basic_dyndim
+
+namespace vnix {
+namespace units {
+
+
+/// List of encodings of dimensions, one for each element of a state.
+/// @tparam D  Encoding of dimension of each element.
+template <dim::word... D> struct dim_list {
+  enum : size_t { size = sizeof...(D) }; ///< Number of elements.
+
+  /// Encoding of dimension at offset.
+  /// @param i  Offset of element.
+  constexpr static dim::word at(size_t i) {
+    dim::word const a[] = {D..., 0};
+    return a[i];
+  }
+};
+
+
+namespace impl {
+
+
+/// Encoding of quotient of two dimensions.
+/// @param n  Encoding of dimension of numerator.
+/// @param d  Encoding of dimension of denominator.
+constexpr dim::word quot_code(dim::word n, dim::word d) {
+  return (dim(n) - dim(d)).encode();
+}
+
+/// List of reciprocals of dimensions in list.
+template <typename L> struct recip_list;
+
+/// List of reciprocals of dimensions in list.
+/// @tparam D  Encoding of dimension of each element.
+template <dim::word... D> struct recip_list<dim_list<D...>> {
+  using type = dim_list<quot_code(nul_code, D)...>; ///< Reciprocals.
+};
+
+
+} // namespace impl
+
+
+/// Reciprocal of each dimension in list L.
+template <typename L> using recip_t = typename impl::recip_list<L>::type;
+
+template <typename T, typename L> class basic_state_vec;
+template <typename T, typename R, typename C> class basic_state_mat;
+
+
+/// Column-vector of quantities whose dimensions are known at compile-time and
+/// may differ from element to element, such as the position and velocity in
+/// the state of a Kalman filter.
+///
+/// The numbers are stored, in units of the basis, in a vnix::mv::col, and
+/// every operation works directly on that storage.  Dimensions are checked
+/// only by the compiler.
+///
+/// @tparam T  Type of number (float, double, etc.).
+/// @tparam D  Encoding of dimension of each element.
+template <typename T, dim::word... D>
+class basic_state_vec<T, dim_list<D...>> {
+public:
+  using dims = dim_list<D...>; ///< Dimension of each element.
+  enum : size_t { N = dims::size }; ///< Number of elements.
+
+  /// Type of element at offset.
+  /// @tparam I  Offset of element.
+  template <size_t I> using elem = basic_statdim<dims::at(I), T>;
+
+private:
+  mv::col<T, N> v_; ///< Numbers, in units of the basis.
+
+public:
+  basic_state_vec() {} ///< By default, do not initialize.
+
+  /// Initialize from quantities.
+  /// This will throw an exception if a quantity whose dimension be known
+  /// only at run-time be incompatible.
+  /// @param q  Quantity for each element.
+  basic_state_vec(basic_statdim<D, T> const &... q) : v_(q.raw_number()...) {}
+
+  /// State from numbers in units of the basis.
+  /// @param v  Numbers.
+  static basic_state_vec from_raw(mv::col<T, N> const &v) {
+    basic_state_vec s;
+    s.v_ = v;
+    return s;
+  }
+
+  /// Numbers in units of the basis.
+  mv::col<T, N> const &raw() const { return v_; }
+
+  /// Mutable numbers in units of the basis.
+  mv::col<T, N> &raw() { return v_; }
+
+  /// Element at offset known at compile-time.
+  /// @tparam I  Offset of element.
+  template <size_t I> elem<I> get() const {
+    return dimval<T, statdim_base<dims::at(I)>>(v_.a[I], dim(dims::at(I)));
+  }
+
+  /// Replace element at offset known at compile-time.
+  /// @tparam I  Offset of element.
+  /// @param  q  New value of element.
+  template <size_t I> void set(elem<I> const &q) { v_.a[I] = q.raw_number(); }
+
+  /// Element at offset known at run-time.
+  /// @param i  Offset of element.
+  basic_dyndim<T> operator[](size_t i) const {
+    return dimval<T, dyndim_base>(v_.a[i], dim(dims::at(i)));
+  }
+
+  /// Add state of same dimensions.
+  basic_state_vec operator+(basic_state_vec const &s) const {
+    return from_raw(v_ + s.v_);
+  }
+
+  /// Subtract state of same dimensions.
+  basic_state_vec operator-(basic_state_vec const &s) const {
+    return from_raw(v_ - s.v_);
+  }
+
+  /// Scale by dimensionless number.
+  /// @param f  Factor.
+  basic_state_vec operator*(T f) const { return from_raw(v_ * f); }
+};
+
+
+/// Matrix of quantities whose dimensions are known at compile-time, such as
+/// the transition, gain, or covariance of a Kalman filter.
+///
+/// The dimension of the element at row i and column j is R[i] / C[j].  So
+/// the matrix maps a state with dimensions C to a state with dimensions R,
+/// and the covariance of a state with dimensions D has R = D and C = 1 / D.
+/// A product is allowed only when the columns of the left-hand factor match
+/// the rows of the right-hand factor, and so a mistake of dimension is a
+/// compile-time error.
+///
+/// The numbers are stored, in units of the basis, in a vnix::mv::mat, and
+/// every operation works directly on that storage.
+///
+/// @tparam T  Type of number (float, double, etc.).
+/// @tparam R  Encoding of dimension associated with each row.
+/// @tparam C  Encoding of dimension associated with each column.
+template <typename T, dim::word... R, dim::word... C>
+class basic_state_mat<T, dim_list<R...>, dim_list<C...>> {
+public:
+  using rows = dim_list<R...>; ///< Dimension associated with each row.
+  using cols = dim_list<C...>; ///< Dimension associated with each column.
+  enum : size_t { NR = rows::size, NC = cols::size };
+
+  /// Type of element at offsets.
+  /// @tparam I  Offset of row.
+  /// @tparam J  Offset of column.
+  template <size_t I, size_t J>
+  using elem = basic_statdim<impl::quot_code(rows::at(I), cols::at(J)), T>;
+
+private:
+  mv::mat<T, NR, NC> m_; ///< Numbers, in units of the basis.
+
+public:
+  basic_state_mat() {} ///< By default, do not initialize.
+
+  /// Matrix from numbers in units of the basis.
+  /// @param m  Numbers.
+  static basic_state_mat from_raw(mv::mat<T, NR, NC> const &m) {
+    basic_state_mat r;
+    r.m_ = m;
+    return r;
+  }
+
+  /// Matrix with every element zero.
+  static basic_state_mat zero() {
+    basic_state_mat z;
+    for (auto &e : z.m_.a) { e = 0; }
+    return z;
+  }
+
+  /// Identity, which is available only when every diagonal element is
+  /// dimensionless.
+  static basic_state_mat identity() {
+    static_assert(std::is_same<rows, cols>::value,
+                  "identity requires rows and columns of same dimensions");
+    basic_state_mat z = zero();
+    for (size_t i = 0; i < NR; ++i) { z.m_(i, i) = 1; }
+    return z;
+  }
+
+  /// Numbers in units of the basis.
+  mv::mat<T, NR, NC> const &raw() const { return m_; }
+
+  /// Mutable numbers in units of the basis.
+  mv::mat<T, NR, NC> &raw() { return m_; }
+
+  /// Element at offsets known at compile-time.
+  /// @tparam I  Offset of row.
+  /// @tparam J  Offset of column.
+  template <size_t I, size_t J> elem<I, J> get() const {
+    constexpr dim::word d = impl::quot_code(rows::at(I), cols::at(J));
+    return dimval<T, statdim_base<d>>(m_(I, J), dim(d));
+  }
+
+  /// Replace element at offsets known at compile-time.
+  /// @tparam I  Offset of row.
+  /// @tparam J  Offset of column.
+  /// @param  q  New value of element.
+  template <size_t I, size_t J> void set(elem<I, J> const &q) {
+    m_(I, J) = q.raw_number();
+  }
+
+  /// Element at offsets known at run-time.
+  /// @param i  Offset of row.
+  /// @param j  Offset of column.
+  basic_dyndim<T> operator()(size_t i, size_t j) const {
+    dim const d = dim(rows::at(i)) - dim(cols::at(j));
+    return dimval<T, dyndim_base>(m_(i, j), d);
+  }
+
+  /// Add matrix of same dimensions.
+  basic_state_mat operator+(basic_state_mat const &m) const {
+    return from_raw(m_ + m.m_);
+  }
+
+  /// Subtract matrix of same dimensions.
+  basic_state_mat operator-(basic_state_mat const &m) const {
+    return from_raw(m_ - m.m_);
+  }
+
+  /// Scale by dimensionless number.
+  /// @param f  Factor.
+  basic_state_mat operator*(T f) const { return from_raw(m_ * f); }
+
+  /// Multiply matrix whose rows match columns of this matrix.
+  /// @tparam OC  Dimension associated with each column of factor.
+  /// @param  m   Factor.
+  template <typename OC>
+  basic_state_mat<T, rows, OC>
+  operator*(basic_state_mat<T, cols, OC> const &m) const {
+    return basic_state_mat<T, rows, OC>::from_raw(m_ * m.raw());
+  }
+
+  /// Multiply state whose dimensions match columns of this matrix.
+  /// @param s  State.
+  basic_state_vec<T, rows> operator*(basic_state_vec<T, cols> const &s) const {
+    return basic_state_vec<T, rows>::from_raw(m_ * s.raw());
+  }
+};
+
+
+/// Transpose of matrix.  Element (j, i) of the transpose has the dimension of
+/// element (i, j) of the original.
+/// @tparam T  Type of number.
+/// @tparam R  Dimensions associated with rows.
+/// @tparam C  Dimensions associated with columns.
+/// @param  m  Matrix.
+template <typename T, typename R, typename C>
+basic_state_mat<T, recip_t<C>, recip_t<R>>
+transpose(basic_state_mat<T, R, C> const &m) {
+  using TM = basic_state_mat<T, recip_t<C>, recip_t<R>>;
+  return TM::from_raw(mv::transpose(m.raw()));
+}
+
+/// Inverse of square matrix, which maps a state with dimensions R back to a
+/// state with dimensions C.
+/// @tparam T  Type of number.
+/// @tparam R  Dimensions associated with rows.
+/// @tparam C  Dimensions associated with columns.
+/// @param  m  Matrix.
+template <typename T, typename R, typename C>
+basic_state_mat<T, C, R> inverse(basic_state_mat<T, R, C> const &m) {
+  return basic_state_mat<T, C, R>::from_raw(mv::inverse(m.raw()));
+}
+
+/// Outer product of two states.  The outer product of a state with itself
+/// has the type of the covariance of the state.
+/// @tparam T  Type of number.
+/// @tparam A  Dimensions of left-hand state.
+/// @tparam B  Dimensions of right-hand state.
+/// @param  a  Left-hand state.
+/// @param  b  Right-hand state.
+template <typename T, typename A, typename B>
+basic_state_mat<T, A, recip_t<B>> outer(basic_state_vec<T, A> const &a,
+                                        basic_state_vec<T, B> const &b) {
+  mv::mat<T, A::size, B::size> m;
+  for (size_t i = 0; i < A::size; ++i) {
+    for (size_t j = 0; j < B::size; ++j) {
+      m(i, j) = a.raw().a[i] * b.raw().a[j];
+    }
+  }
+  return basic_state_mat<T, A, recip_t<B>>::from_raw(m);
+}
+
+
+/// State-vector whose elements are quantities of types Q, such as
+/// `state_vec<dbl::length, dbl::speed>`.
+/// @tparam Q  Type of each element.
+template <typename Q, typename... QS>
+using state_vec = basic_state_vec<
+    std::decay_t<decltype(std::declval<Q>().raw_number())>,
+    dim_list<Q::d().encode(), QS::d().encode()...>>;
+
+/// Matrix that maps a state of type SC to a state of type SR, such as the
+/// transition of a Kalman filter.
+/// @tparam SR  Type of state produced.
+/// @tparam SC  Type of state consumed.
+template <typename SR, typename SC>
+using state_map =
+    basic_state_mat<std::decay_t<decltype(std::declval<SR>().raw().a[0])>,
+                    typename SR::dims, typename SC::dims>;
+
+/// Covariance of state of type S, whose element (i, j) has dimension
+/// d[i] * d[j].
+/// @tparam S  Type of state.
+template <typename S>
+using covariance =
+    basic_state_mat<std::decay_t<decltype(std::declval<S>().raw().a[0])>,
+                    typename S::dims, recip_t<typename S::dims>>;
+
+
+} // namespace units
+} // namespace vnix
+
+#endif // ndef VNIX_UNITS_STATE_HPP
@@ -0,0 +1,203 @@
+/// @file       vnix/units/table.hpp
+/// @brief      Definition of vnix::units::basic_table and column_spec.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD Three-Clause; see LICENSE.
+
+#ifndef VNIX_UNITS_TABLE_HPP
+#define VNIX_UNITS_TABLE_HPP
+
+#include <initializer_list>             // for initializer_list
+#include <string>                       // for string
+#include <vector>                       // for vector
+#include <vnix/units/quantity-span.hpp> // for statdim_span, dyndim_span
+
+namespace vnix {
+namespace units {
+
+
+/// Name and dimension of a column in a basic_table.
+struct column_spec {
+  std::string name; ///< Name of column.
+  dim         d;    ///< Dimension shared by every quantity in column.
+
+  /// Initialize from name and dimension.
+  /// @param n   Name of column.
+  /// @param dd  Dimension of column.
+  column_spec(std::string const &n, dim dd) : name(n), d(dd) {}
+
+  /// Specification of column whose dimension is that of a statdim-type, such
+  /// as vnix::units::flt::speed or vnix::units::dbl::pressure.
+  /// @tparam Q  Type of statically dimensioned quantity.
+  /// @param  n  Name of column.
+  template <typename Q> static column_spec of(std::string const &n) {
+    return column_spec(n, Q::d());
+  }
+};
+
+
+/// Table of dimensioned quantities, stored by column.
+///
+/// The schema, a list of column_spec, is fixed on construction.  Each column
+/// is a contiguous array of numbers in units of the basis, and the dimension
+/// of each column is stored once, in the schema.  A column may be projected,
+/// without copying, as a dyndim_span or, after one check of dimension, as a
+/// statdim_span.
+///
+/// @tparam T  Type of each number (float, double, etc.).
+template <typename T> class basic_table {
+  std::vector<column_spec>    schema_; ///< Name and dimension of each column.
+  std::vector<std::vector<T>> cols_;   ///< Numbers in each column.
+  size_t                      rows_;   ///< Number of rows.
+
+  /// Throw if a row's dimensions do not match the schema.
+  /// @tparam Q  Type of dimensioned quantity in row.
+  /// @param  b  Pointer to first quantity in row.
+  /// @param  n  Number of quantities in row.
+  template <typename Q> void check_row(Q const *b, size_t n) const {
+    if (n != schema_.size()) { error("wrong number of columns in row"); }
+    for (size_t c = 0; c < n; ++c) {
+      if (b[c].d() != schema_[c].d) {
+        error("incompatible dimension for column");
+      }
+    }
+  }
+
+public:
+  using spans       = std::vector<dyndim_span<T const>>; ///< Column-batch.
+  using number_type = T; ///< Type of each number.
+
+  /// Initialize from schema.
+  /// @param s  Name and dimension of each column.
+  basic_table(std::vector<column_spec> const &s)
+      : schema_(s), cols_(s.size()), rows_(0) {
+    for (size_t i = 0; i < s.size(); ++i) {
+      for (size_t j = 0; j < i; ++j) {
+        if (s[i].name == s[j].name) { error("duplicate name of column"); }
+      }
+    }
+  }
+
+  /// Initialize from list of column-specifications.
+  /// @param s  Name and dimension of each column.
+  basic_table(std::initializer_list<column_spec> s)
+      : basic_table(std::vector<column_spec>(s)) {}
+
+  size_t rows() const { return rows_; }          ///< Number of rows.
+  size_t cols() const { return schema_.size(); } ///< Number of columns.
+
+  /// Name and dimension of each column.
+  std::vector<column_spec> const &schema() const { return schema_; }
+
+  /// Offset of column with specified name.
+  /// This will throw an exception if there be no such column.
+  /// @param name  Name of column.
+  size_t index(std::string const &name) const {
+    for (size_t c = 0; c < schema_.size(); ++c) {
+      if (schema_[c].name == name) { return c; }
+    }
+    error("no column with specified name");
+    return schema_.size();
+  }
+
+  /// Reserve storage for specified number of rows.
+  /// @param n  Number of rows.
+  void reserve(size_t n) {
+    for (auto &c : cols_) { c.reserve(n); }
+  }
+
+  /// Append row of dimensioned quantities, one for each column.
+  ///
+  /// Every dimension in the row is validated before any column is modified,
+  /// and so the table is unchanged if an exception be thrown.
+  ///
+  /// @param row  Quantities in order of columns.
+  void append(std::initializer_list<basic_dyndim<T>> row) {
+    check_row(row.begin(), row.size());
+    auto i = row.begin();
+    for (auto &c : cols_) { c.push_back((i++)->raw_number()); }
+    ++rows_;
+  }
+
+  /// Append row of dimensioned quantities, one for each column.
+  /// @param row  Quantities in order of columns.
+  void append(std::vector<basic_dyndim<T>> const &row) {
+    check_row(row.data(), row.size());
+    for (size_t c = 0; c < cols_.size(); ++c) {
+      cols_[c].push_back(row[c].raw_number());
+    }
+    ++rows_;
+  }
+
+  /// Append many rows, supplied as one span for each column.
+  ///
+  /// The dimension of each span is checked once, and then the numbers are
+  /// copied in bulk.
+  ///
+  /// @param s  Spans in order of columns; every span must be of same size.
+  void append(spans const &s) {
+    check_row(s.data(), s.size());
+    size_t const n = s.empty() ? 0 : s[0].size();
+    for (auto const &c : s) {
+      if (c.size() != n) { error("spans of different size"); }
+    }
+    for (size_t c = 0; c < cols_.size(); ++c) {
+      cols_[c].insert(cols_[c].end(), s[c].data(), s[c].data() + n);
+    }
+    rows_ += n;
+  }
+
+  /// Dimensioned quantity at specified row and column.
+  /// @param r  Offset of row.
+  /// @param c  Offset of column.
+  basic_dyndim<T> at(size_t r, size_t c) const {
+    return dimval<T, dyndim_base>(cols_.at(c).at(r), schema_[c].d);
+  }
+
+  /// Immutable view, without copying, of column at specified offset.
+  /// @param c  Offset of column.
+  dyndim_span<T const> column(size_t c) const {
+    return {cols_.at(c).data(), rows_, schema_[c].d};
+  }
+
+  /// Mutable view, without copying, of column at specified offset.
+  /// @param c  Offset of column.
+  dyndim_span<T> column(size_t c) {
+    return {cols_.at(c).data(), rows_, schema_[c].d};
+  }
+
+  /// Immutable view, without copying, of column with specified name.
+  /// @param name  Name of column.
+  dyndim_span<T const> column(std::string const &name) const {
+    return column(index(name));
+  }
+
+  /// Mutable view, without copying, of column with specified name.
+  /// @param name  Name of column.
+  dyndim_span<T> column(std::string const &name) {
+    return column(index(name));
+  }
+
+  /// Immutable view, without copying, of column with specified name.  The
+  /// dimension is checked once, against that of the statdim-type Q.
+  /// @tparam Q    Type of statically dimensioned quantity (e.g., flt::speed).
+  /// @param  name Name of column.
+  template <typename Q> auto column(std::string const &name) const {
+    dim::word constexpr D = Q::d().encode();
+    return column(index(name)).template as<D>();
+  }
+
+  /// Mutable view, without copying, of column with specified name.  The
+  /// dimension is checked once, against that of the statdim-type Q.
+  /// @tparam Q    Type of statically dimensioned quantity (e.g., flt::speed).
+  /// @param  name Name of column.
+  template <typename Q> auto column(std::string const &name) {
+    dim::word constexpr D = Q::d().encode();
+    return column(index(name)).template as<D>();
+  }
+};
+
+
+} // namespace units
+} // namespace vnix
+
+#endif // ndef VNIX_UNITS_TABLE_HPP
@@ -0,0 +1,347 @@
+/// @file       vnix/units/temperature.hpp
+/// @brief      Definition of vnix::units::basic_abs_temperature and of affine
+///             scales of temperature.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD Three-Clause; see LICENSE.
+
+#ifndef VNIX_UNITS_TEMPERATURE_HPP
+#define VNIX_UNITS_TEMPERATURE_HPP
+
+#include <cstddef>                      // for size_t
+#include <utility>                      // for declval
+#include <vnix/units.hpp>               // for kelvins, temperature_dim
+#include <vnix/units/quantity-span.hpp> // for statdim_span
+#include <vnix/units/soa-kernel.hpp>    // for SOA_BLOCK
+
+namespace vnix {
+namespace units {
+
+
+// Each scale of temperature is affine: a reading x on the scale is the
+// absolute temperature sf() * x + off() in kelvins.  A difference between two
+// readings is the difference sf() * dx in kelvins, without offset.
+
+
+/// Kelvin-scale, on which zero is absolute zero.
+struct kelvin_scale {
+  constexpr static long double sf() { return 1; }  ///< Kelvins per degree.
+  constexpr static long double off() { return 0; } ///< Kelvins at zero.
+};
+
+/// Celsius-scale, on which zero is 273.15 K.
+struct celsius_scale {
+  constexpr static long double sf() { return 1; }        ///< Kelvins/degree.
+  constexpr static long double off() { return 273.15L; } ///< Kelvins at 0.
+};
+
+/// Fahrenheit-scale, on which zero is 459.67 degrees above absolute zero.
+struct fahrenheit_scale {
+  constexpr static long double sf() { return 5.0L / 9.0L; }     ///< K/degree.
+  constexpr static long double off() { return 459.67L * sf(); } ///< K at 0.
+};
+
+/// Rankine-scale, on which zero is absolute zero.
+struct rankine_scale {
+  constexpr static long double sf() { return 5.0L / 9.0L; } ///< K/degree.
+  constexpr static long double off() { return 0; }          ///< K at zero.
+};
+
+
+namespace impl {
+
+
+/// Replace each number x by a * x + b.
+///
+/// Each full block is scaled into a local array, which the compiler knows not
+/// to alias, and then offset into the output.  Both loops have a fixed count
+/// and no branch, so that they vectorize at -O2 without a check of aliasing
+/// at run-time; and neither is a bare copy, which the compiler would replace
+/// by a call to memcpy.  The partial block at the end is computed directly.
+/// The output may overwrite the input.
+///
+/// @tparam T  Type of number.
+/// @param  x  Array of input.
+/// @param  y  Array of output.
+/// @param  n  Number of elements.
+/// @param  a  Scale-factor.
+/// @param  b  Offset.
+template <typename T>
+void affine_apply(T const *x, T *y, size_t n, T a, T b) {
+  size_t const B = SOA_BLOCK;
+  T            l[B];
+  size_t       j = 0;
+  for (; j + B <= n; j += B) {
+    for (size_t i = 0; i < B; ++i) { l[i] = a * x[j + i]; }
+    for (size_t i = 0; i < B; ++i) { y[j + i] = l[i] + b; }
+  }
+  for (; j < n; ++j) { y[j] = a * x[j] + b; }
+}
+
+
+/// Scale-factor from reading on scale S to kelvins.
+template <typename S, typename T> constexpr T to_k_sf() { return T(S::sf()); }
+
+/// Offset from reading on scale S to kelvins.
+template <typename S, typename T> constexpr T to_k_off() {
+  return T(S::off());
+}
+
+/// Scale-factor from kelvins to reading on scale S.
+template <typename S, typename T> constexpr T from_k_sf() {
+  return T(1 / S::sf());
+}
+
+/// Offset from kelvins to reading on scale S.
+template <typename S, typename T> constexpr T from_k_off() {
+  return T(-S::off() / S::sf());
+}
+
+
+} // namespace impl
+
+
+/// Absolute temperature, which is a point on a scale of temperature, as
+/// distinct from a difference between two temperatures.
+///
+/// The difference between two absolute temperatures is an ordinary quantity
+/// of dimension temperature, which may be added to or subtracted from an
+/// absolute temperature; as for any sum of quantities, an interval of other
+/// dimension is rejected at compile-time, and a dyndim is checked at
+/// run-time.  But the sum of two absolute temperatures, like a multiple of
+/// one, depends on the zero of the scale, and so it is rejected at
+/// compile-time.
+///
+/// @tparam T  Type of number.
+template <typename T> class basic_abs_temperature {
+public:
+  /// Type of difference between two absolute temperatures.
+  using interval_type = basic_statdim<temperature_dim.encode(), T>;
+
+private:
+  interval_type k_; ///< Interval above absolute zero.
+
+  /// Type int only for base-dimension of interval that may be added to
+  /// absolute temperature, so that any other is excluded by SFINAE.
+  /// @tparam OB  Base-dimension type of interval.
+  template <typename OB>
+  using itest = decltype(interval_type::sum(std::declval<OB>()), 0);
+
+public:
+  /// By default, leave number uninitialized.
+  basic_abs_temperature() = default;
+
+  /// Initialize from interval above absolute zero, such as `300 * K`.
+  /// @param k  Interval above absolute zero.
+  constexpr explicit basic_abs_temperature(interval_type const &k) : k_(k) {}
+
+  /// Absolute temperature from reading on specified scale.
+  /// @tparam S  Scale, such as celsius_scale.
+  /// @param  x  Reading on scale.
+  template <typename S> constexpr static basic_abs_temperature on(T x) {
+    T const k = impl::to_k_sf<S, T>() * x + impl::to_k_off<S, T>();
+    return basic_abs_temperature(impl::kelvins<T>(k));
+  }
+
+  /// Reading on specified scale.
+  /// @tparam S  Scale, such as fahrenheit_scale.
+  template <typename S> constexpr T in() const {
+    T const k = k_.raw_number();
+    return impl::from_k_sf<S, T>() * k + impl::from_k_off<S, T>();
+  }
+
+  /// Interval above absolute zero, as a quantity in kelvins.
+  constexpr interval_type const &from_zero() const { return k_; }
+
+  /// Absolute temperature displaced by interval.
+  /// @tparam OT  Numeric type of interval.
+  /// @tparam OB  Base-dimension type of interval.
+  /// @param  d   Interval.
+  template <typename OT, typename OB, itest<OB> = 0>
+  constexpr basic_abs_temperature &operator+=(dimval<OT, OB> const &d) {
+    k_ += d;
+    return *this;
+  }
+
+  /// Absolute temperature displaced by negative of interval.
+  /// @tparam OT  Numeric type of interval.
+  /// @tparam OB  Base-dimension type of interval.
+  /// @param  d   Interval.
+  template <typename OT, typename OB, itest<OB> = 0>
+  constexpr basic_abs_temperature &operator-=(dimval<OT, OB> const &d) {
+    k_ -= d;
+    return *this;
+  }
+
+  /// Absolute temperature displaced by interval.
+  /// @tparam OT  Numeric type of interval.
+  /// @tparam OB  Base-dimension type of interval.
+  /// @param  a   Absolute temperature.
+  /// @param  d   Interval.
+  template <typename OT, typename OB, itest<OB> = 0>
+  friend constexpr basic_abs_temperature
+  operator+(basic_abs_temperature a, dimval<OT, OB> const &d) {
+    return a += d;
+  }
+
+  /// Absolute temperature displaced by interval.
+  /// @tparam OT  Numeric type of interval.
+  /// @tparam OB  Base-dimension type of interval.
+  /// @param  d   Interval.
+  /// @param  a   Absolute temperature.
+  template <typename OT, typename OB, itest<OB> = 0>
+  friend constexpr basic_abs_temperature
+  operator+(dimval<OT, OB> const &d, basic_abs_temperature a) {
+    return a += d;
+  }
+
+  /// Absolute temperature displaced by negative of interval.
+  /// @tparam OT  Numeric type of interval.
+  /// @tparam OB  Base-dimension type of interval.
+  /// @param  a   Absolute temperature.
+  /// @param  d   Interval.
+  template <typename OT, typename OB, itest<OB> = 0>
+  friend constexpr basic_abs_temperature
+  operator-(basic_abs_temperature a, dimval<OT, OB> const &d) {
+    return a -= d;
+  }
+
+  /// Interval between two absolute temperatures.
+  /// @param a  Minuend.
+  /// @param b  Subtrahend.
+  friend constexpr interval_type operator-(basic_abs_temperature const &a,
+                                           basic_abs_temperature const &b) {
+    return a.k_ - b.k_;
+  }
+
+  /// Sum of two absolute temperatures is meaningless.
+  friend void operator+(basic_abs_temperature const &,
+                        basic_abs_temperature const &) = delete;
+
+  /// True only if two absolute temperatures be equal.
+  friend constexpr bool operator==(basic_abs_temperature const &a,
+                                   basic_abs_temperature const &b) {
+    return a.k_ == b.k_;
+  }
+
+  /// True only if two absolute temperatures be unequal.
+  friend constexpr bool operator!=(basic_abs_temperature const &a,
+                                   basic_abs_temperature const &b) {
+    return a.k_ != b.k_;
+  }
+
+  /// True only if one absolute temperature be less than another.
+  friend constexpr bool operator<(basic_abs_temperature const &a,
+                                  basic_abs_temperature const &b) {
+    return a.k_ < b.k_;
+  }
+
+  /// True only if one absolute temperature be no greater than another.
+  friend constexpr bool operator<=(basic_abs_temperature const &a,
+                                   basic_abs_temperature const &b) {
+    return a.k_ <= b.k_;
+  }
+
+  /// True only if one absolute temperature be greater than another.
+  friend constexpr bool operator>(basic_abs_temperature const &a,
+                                  basic_abs_temperature const &b) {
+    return a.k_ > b.k_;
+  }
+
+  /// True only if one absolute temperature be no less than another.
+  friend constexpr bool operator>=(basic_abs_temperature const &a,
+                                   basic_abs_temperature const &b) {
+    return a.k_ >= b.k_;
+  }
+};
+
+
+/// Absolute temperature from reading in degrees Celsius.
+/// @tparam T  Type of number.
+/// @param  x  Reading.
+template <typename T> constexpr auto celsius(T x) {
+  return basic_abs_temperature<T>::template on<celsius_scale>(x);
+}
+
+/// Absolute temperature from reading in degrees Fahrenheit.
+/// @tparam T  Type of number.
+/// @param  x  Reading.
+template <typename T> constexpr auto fahrenheit(T x) {
+  return basic_abs_temperature<T>::template on<fahrenheit_scale>(x);
+}
+
+/// Absolute temperature from reading in degrees Rankine.
+/// @tparam T  Type of number.
+/// @param  x  Reading.
+template <typename T> constexpr auto rankine(T x) {
+  return basic_abs_temperature<T>::template on<rankine_scale>(x);
+}
+
+/// Interval, in kelvins, from difference in degrees Celsius.
+/// @tparam T   Type of number.
+/// @param  dx  Difference.
+template <typename T>
+constexpr basic_statdim<temperature_dim.encode(), T> celsius_diff(T dx) {
+  return impl::kelvins<T>(impl::to_k_sf<celsius_scale, T>() * dx);
+}
+
+/// Interval, in kelvins, from difference in degrees Fahrenheit.
+/// @tparam T   Type of number.
+/// @param  dx  Difference.
+template <typename T>
+constexpr basic_statdim<temperature_dim.encode(), T> fahrenheit_diff(T dx) {
+  return impl::kelvins<T>(impl::to_k_sf<fahrenheit_scale, T>() * dx);
+}
+
+
+/// Convert readings on a scale into absolute temperatures in kelvins.
+///
+/// Each conversion is a multiplication and an addition, without branch, over
+/// blocks that the compiler vectorizes.  Every element is equal, up to
+/// rounding, to `basic_abs_temperature<T>::on<S>(x[i]).from_zero()`.
+///
+/// @tparam S  Scale, such as celsius_scale.
+/// @tparam T  Type of number.
+/// @param  x  Array of k.size() readings; may be k.data().
+/// @param  k  Span of absolute temperatures in kelvins.
+template <typename S, typename T>
+void to_kelvins(T const *x, statdim_span<temperature_dim.encode(), T> k) {
+  T const sf = impl::to_k_sf<S, T>(), off = impl::to_k_off<S, T>();
+  impl::affine_apply(x, k.data(), k.size(), sf, off);
+}
+
+
+/// Convert absolute temperatures in kelvins into readings on a scale.
+///
+/// Every element is equal, up to rounding, to
+/// `basic_abs_temperature<T>(k[i]).in<S>()`.
+///
+/// @tparam S   Scale, such as fahrenheit_scale.
+/// @tparam KT  Type of number in span (possibly const).
+/// @tparam T   Type of number.
+/// @param  k   Span of absolute temperatures in kelvins.
+/// @param  x   Array of k.size() readings; may be k.data().
+template <typename S, typename KT, typename T>
+void from_kelvins(statdim_span<temperature_dim.encode(), KT> k, T *x) {
+  T const *const p  = k.data();
+  T const        sf = impl::from_k_sf<S, T>(), off = impl::from_k_off<S, T>();
+  impl::affine_apply(p, x, k.size(), sf, off);
+}
+
+
+namespace flt {
+using abs_temperature = basic_abs_temperature<float>; ///< Absolute temp.
+} // namespace flt
+
+namespace dbl {
+using abs_temperature = basic_abs_temperature<double>; ///< Absolute temp.
+} // namespace dbl
+
+namespace ldbl {
+using abs_temperature = basic_abs_temperature<long double>; ///< Absolute.
+} // namespace ldbl
+
+
+} // namespace units
+} // namespace vnix
+
+#endif // ndef VNIX_UNITS_TEMPERATURE_HPP
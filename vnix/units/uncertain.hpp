@@ -0,0 +1,324 @@
+/// @file       vnix/units/uncertain.hpp
+/// @brief      Definition of vnix::units::uncertain and basic_uncertain_batch.
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD Three-Clause; see LICENSE.
+
+#ifndef VNIX_UNITS_UNCERTAIN_HPP
+#define VNIX_UNITS_UNCERTAIN_HPP
+
+#include <cmath>                     // for sqrt, pow, abs
+#include <ostream>                   // for ostream
+#include <vector>                    // for vector
+#include <vnix/units/dimval.hpp>     // for dimval, basic_dyndim
+#include <vnix/units/soa-kernel.hpp> // for soa_apply
+
+namespace vnix {
+namespace units {
+
+
+/// Number with standard uncertainty, for use as the numeric type of a
+/// dimval, as in `dimval<uncertain<double>, B>`.
+///
+/// The uncertainty is propagated to first order through +, -, *, /, power,
+/// and square_root, on the assumption that the operands are uncorrelated.
+/// Because the uncertainty is stored beside the value in the same dimval, it
+/// has the same dimension as the value.
+///
+/// @tparam T  Type of number (float, double, etc.).
+template <typename T> struct uncertain {
+  T v; ///< Best estimate.
+  T s; ///< Standard uncertainty (one sigma), never negative.
+
+  uncertain() {} ///< By default, do not initialize.
+
+  /// Initialize from best estimate and standard uncertainty.
+  /// @param vv  Best estimate.
+  /// @param ss  Standard uncertainty (by default, zero).
+  constexpr uncertain(T vv, T ss = 0) : v(vv), s(ss) {}
+
+  /// Sum.
+  friend uncertain operator+(uncertain const &a, uncertain const &b) {
+    return {a.v + b.v, std::sqrt(a.s * a.s + b.s * b.s)};
+  }
+
+  /// Difference.
+  friend uncertain operator-(uncertain const &a, uncertain const &b) {
+    return {a.v - b.v, std::sqrt(a.s * a.s + b.s * b.s)};
+  }
+
+  /// Negation.
+  friend constexpr uncertain operator-(uncertain const &a) {
+    return {-a.v, a.s};
+  }
+
+  /// Product.
+  friend uncertain operator*(uncertain const &a, uncertain const &b) {
+    T const da = a.s * b.v, db = b.s * a.v;
+    return {a.v * b.v, std::sqrt(da * da + db * db)};
+  }
+
+  /// Product with exact number.
+  friend uncertain operator*(uncertain const &a, T k) {
+    return {a.v * k, a.s * std::abs(k)};
+  }
+
+  /// Product with exact number.
+  friend uncertain operator*(T k, uncertain const &a) { return a * k; }
+
+  /// Quotient.
+  friend uncertain operator/(uncertain const &a, uncertain const &b) {
+    T const r = 1 / b.v, q = a.v * r, da = a.s * r, db = q * b.s * r;
+    return {q, std::sqrt(da * da + db * db)};
+  }
+
+  /// Quotient by exact number.
+  friend uncertain operator/(uncertain const &a, T k) {
+    return {a.v / k, a.s / std::abs(k)};
+  }
+
+  /// Multiply in place.
+  uncertain &operator*=(uncertain const &b) { return *this = *this * b; }
+
+  /// Divide in place.
+  uncertain &operator/=(uncertain const &b) { return *this = *this / b; }
+
+  /// Equality of estimate and of uncertainty.
+  friend constexpr bool operator==(uncertain const &a, uncertain const &b) {
+    return a.v == b.v && a.s == b.s;
+  }
+
+  /// Inequality of estimate or of uncertainty.
+  friend constexpr bool operator!=(uncertain const &a, uncertain const &b) {
+    return !(a == b);
+  }
+
+  /// Comparison of estimates.
+  friend constexpr bool operator<(uncertain const &a, uncertain const &b) {
+    return a.v < b.v;
+  }
+
+  /// Comparison of estimates.
+  friend constexpr bool operator>(uncertain const &a, uncertain const &b) {
+    return a.v > b.v;
+  }
+
+  /// Comparison of estimates.
+  friend constexpr bool operator<=(uncertain const &a, uncertain const &b) {
+    return a.v <= b.v;
+  }
+
+  /// Comparison of estimates.
+  friend constexpr bool operator>=(uncertain const &a, uncertain const &b) {
+    return a.v >= b.v;
+  }
+
+  /// Real power, for dimval::power().
+  /// @param a  Base.
+  /// @param p  Exponent.
+  friend uncertain pow(uncertain const &a, double p) {
+    T const r = T(std::pow(a.v, p));
+    return {r, std::abs(T(p) * r / a.v) * a.s};
+  }
+
+  /// Square-root, for dimval::square_root().
+  /// @param a  Radicand.
+  friend uncertain sqrt(uncertain const &a) {
+    T const r = std::sqrt(a.v);
+    return {r, a.s / (2 * r)};
+  }
+
+  /// Print as "(v +/- s)".
+  friend std::ostream &operator<<(std::ostream &os, uncertain const &a) {
+    return os << "(" << a.v << " +/- " << a.s << ")";
+  }
+};
+
+
+/// Quantity with uncertainty, from best estimate and standard uncertainty.
+/// This will throw an exception if the dimensions, known only at run-time, be
+/// different.
+/// @tparam T   Type of number.
+/// @tparam B   Base of estimate.
+/// @tparam OB  Base of uncertainty.
+/// @param  v   Best estimate.
+/// @param  s   Standard uncertainty.
+template <typename T, typename B, typename OB>
+constexpr dimval<uncertain<T>, B> with_sigma(dimval<T, B> const & v,
+                                             dimval<T, OB> const &s) {
+  v.comparison(s);
+  return dimval<uncertain<T>, B>(
+      uncertain<T>(v.raw_number(), s.raw_number()), v.d());
+}
+
+/// Best estimate of quantity with uncertainty.
+/// @tparam T  Type of number.
+/// @tparam B  Base of quantity.
+/// @param  q  Quantity with uncertainty.
+template <typename T, typename B>
+constexpr dimval<T, B> estimate(dimval<uncertain<T>, B> const &q) {
+  return dimval<T, B>(q.raw_number().v, q.d());
+}
+
+/// Standard uncertainty of quantity, with the dimension of the quantity.
+/// @tparam T  Type of number.
+/// @tparam B  Base of quantity.
+/// @param  q  Quantity with uncertainty.
+template <typename T, typename B>
+constexpr dimval<T, B> sigma(dimval<uncertain<T>, B> const &q) {
+  return dimval<T, B>(q.raw_number().s, q.d());
+}
+
+
+/// Structure of arrays of quantities with uncertainty, all of one dimension.
+///
+/// Estimates and uncertainties are stored in separate arrays, in units of
+/// the basis, and the dimension is stored once.  Arithmetic on two batches
+/// computes the dimension of the result once and propagates every
+/// uncertainty in a loop that the compiler can vectorize.
+///
+/// @tparam T  Type of number (float, double, etc.).
+template <typename T> class basic_uncertain_batch {
+  std::vector<T> v_; ///< Best estimates.
+  std::vector<T> s_; ///< Standard uncertainties.
+  dim            d_; ///< Dimension of every element.
+
+public:
+  /// Initialize batch whose every element is zero with no uncertainty.
+  /// @param n   Number of elements.
+  /// @param dd  Dimension of every element.
+  basic_uncertain_batch(size_t n = 0, dim dd = nul_dim)
+      : v_(n), s_(n), d_(dd) {}
+
+  size_t   size() const { return v_.size(); } ///< Number of elements.
+  dim      d() const { return d_; }            ///< Dimension of every element.
+  T *      estimates() { return v_.data(); }   ///< Best estimates.
+  T *      sigmas() { return s_.data(); }      ///< Standard uncertainties.
+  T const *estimates() const { return v_.data(); } ///< Best estimates.
+  T const *sigmas() const { return s_.data(); } ///< Standard uncertainties.
+
+  /// Element at offset.
+  /// @param i  Offset of element.
+  basic_dyndim<uncertain<T>> operator[](size_t i) const {
+    return dimval<uncertain<T>, dyndim_base>(uncertain<T>(v_[i], s_[i]), d_);
+  }
+
+  /// Replace element at offset.
+  /// This will throw an exception if the dimensions be different.
+  /// @tparam B  Base of quantity.
+  /// @param  i  Offset of element.
+  /// @param  q  New quantity.
+  template <typename B>
+  void set(size_t i, dimval<uncertain<T>, B> const &q) {
+    if (q.d() != d_) { error("incompatible dimension for batch"); }
+    v_[i] = q.raw_number().v;
+    s_[i] = q.raw_number().s;
+  }
+
+  /// Add batch of same dimension in place.
+  /// @param b  Addend.
+  basic_uncertain_batch &operator+=(basic_uncertain_batch const &b) {
+    if (d_ != b.d_) { error("incompatible dimensions for addition"); }
+    return apply(b, d_, [](T av, T as, T bv, T bs, T &ov, T &os) {
+      ov = av + bv;
+      os = std::sqrt(as * as + bs * bs);
+    });
+  }
+
+  /// Subtract batch of same dimension in place.
+  /// @param b  Subtrahend.
+  basic_uncertain_batch &operator-=(basic_uncertain_batch const &b) {
+    if (d_ != b.d_) { error("incompatible dimensions for subtraction"); }
+    return apply(b, d_, [](T av, T as, T bv, T bs, T &ov, T &os) {
+      ov = av - bv;
+      os = std::sqrt(as * as + bs * bs);
+    });
+  }
+
+  /// Multiply by batch in place.
+  /// @param b  Factor.
+  basic_uncertain_batch &operator*=(basic_uncertain_batch const &b) {
+    return apply(b, d_ + b.d_, [](T av, T as, T bv, T bs, T &ov, T &os) {
+      T const da = as * bv, db = bs * av;
+      ov         = av * bv;
+      os         = std::sqrt(da * da + db * db);
+    });
+  }
+
+  /// Divide by batch in place.
+  /// @param b  Divisor.
+  basic_uncertain_batch &operator/=(basic_uncertain_batch const &b) {
+    return apply(b, d_ - b.d_, [](T av, T as, T bv, T bs, T &ov, T &os) {
+      T const r = 1 / bv, q = av * r, da = as * r, db = q * bs * r;
+      ov        = q;
+      os        = std::sqrt(da * da + db * db);
+    });
+  }
+
+  /// Sum of two batches.
+  friend basic_uncertain_batch operator+(basic_uncertain_batch a,
+                                         basic_uncertain_batch const &b) {
+    return a += b;
+  }
+
+  /// Difference of two batches.
+  friend basic_uncertain_batch operator-(basic_uncertain_batch a,
+                                         basic_uncertain_batch const &b) {
+    return a -= b;
+  }
+
+  /// Product of two batches.
+  friend basic_uncertain_batch operator*(basic_uncertain_batch a,
+                                         basic_uncertain_batch const &b) {
+    return a *= b;
+  }
+
+  /// Quotient of two batches.
+  friend basic_uncertain_batch operator/(basic_uncertain_batch a,
+                                         basic_uncertain_batch const &b) {
+    return a /= b;
+  }
+
+  /// Rational power of every element.
+  /// @param a  Batch.
+  /// @param p  Exponent.
+  friend basic_uncertain_batch pow(basic_uncertain_batch a, dim::rat p) {
+    T const pd = T(p.to_double());
+    return a.apply(a, a.d_ * p, [pd](T av, T as, T, T, T &ov, T &os) {
+      T const r = std::pow(av, pd);
+      ov        = r;
+      os        = std::abs(pd * r / av) * as;
+    });
+  }
+
+  /// Square-root of every element.
+  /// @param a  Batch.
+  friend basic_uncertain_batch sqrt(basic_uncertain_batch a) {
+    return a.apply(a, a.d_ / dim::rat(2), [](T av, T as, T, T, T &ov, T &os) {
+      T const r = std::sqrt(av);
+      ov        = r;
+      os        = as / (2 * r);
+    });
+  }
+
+private:
+  /// Apply propagation, element by element, to this batch and to other batch
+  /// of same size, and replace this batch by result.
+  /// @tparam F   Type of function(av, as, bv, bs, ov, os).
+  /// @param  b   Other batch, which may be this batch.
+  /// @param  dd  Dimension of result.
+  /// @param  f   Propagation of one element.
+  template <typename F>
+  basic_uncertain_batch &apply(basic_uncertain_batch const &b, dim dd, F f) {
+    if (size() != b.size()) { error("batches of different size"); }
+    impl::soa_apply(v_.data(), s_.data(), b.v_.data(), b.s_.data(),
+                    v_.data(), s_.data(), size(), f);
+    d_ = dd;
+    return *this;
+  }
+};
+
+
+} // namespace units
+} // namespace vnix
+
+#endif // ndef VNIX_UNITS_UNCERTAIN_HPP
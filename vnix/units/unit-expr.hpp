@@ -0,0 +1,223 @@
+/// @file       vnix/units/unit-expr.hpp
+/// @brief      Definition of vnix::units::unit_spec and parse_unit().
+/// @copyright  2019 Thomas E. Vaughan; all rights reserved.
+/// @license    BSD Three-Clause; see LICENSE.
+
+#ifndef VNIX_UNITS_UNIT_EXPR_HPP
+#define VNIX_UNITS_UNIT_EXPR_HPP
+
+#include <cmath>                    // for pow
+#include <cstdlib>                  // for strtold, strtol
+#include <string>                   // for string
+#include <vnix/units/unit-syms.hpp> // for find_unit_sym
+
+namespace vnix {
+namespace units {
+
+
+/// Scale-factor and dimension of a unit, such as might be parsed at run-time
+/// from an expression like "km/s" or "kg m s^-2".
+struct unit_spec {
+  long double sf; ///< Number of base-units in one of the unit.
+  dim         d;  ///< Dimension of unit.
+
+  /// Product of units.
+  /// @param u  Factor.
+  constexpr unit_spec operator*(unit_spec const &u) const {
+    return {sf * u.sf, d + u.d};
+  }
+
+  /// Quotient of units.
+  /// @param u  Divisor.
+  constexpr unit_spec operator/(unit_spec const &u) const {
+    return {sf / u.sf, d - u.d};
+  }
+
+  /// Unit raised to rational power.
+  /// @param p  Power.
+  unit_spec pow(dim::rat p) const {
+    return {std::pow(sf, (long double)(p.to_double())), d * p};
+  }
+};
+
+
+/// Look up unit by symbol in unit_syms.
+struct unit_syms_lookup {
+  /// Find unit for symbol, or throw if there be none.
+  /// @param s  Pointer to first character of symbol.
+  /// @param n  Number of characters in symbol.
+  unit_spec operator()(char const *s, size_t n) const {
+    unit_sym const *u = find_unit_sym(s, n);
+    if (!u) { error("unknown symbol for unit"); }
+    return {u->sf, dim(u->d)};
+  }
+};
+
+
+namespace impl {
+
+
+/// Recursive-descent parser for expression of unit.
+///
+/// The grammar accepts the notation of units.yml (e.g., "0.3048*m", "ft/12",
+/// "kg*m/s/s") as well as the notation printed by dim (e.g., "m g s^-2" or
+/// "s^[-1/2]").  Adjacent factors separated by space are multiplied.
+///
+/// @tparam L  Type of function-object that looks up symbol.
+template <typename L> class unit_parser {
+  char const *p_;      ///< Pointer to next character.
+  char const *e_;      ///< Pointer past last character.
+  L const &   lookup_; ///< Function that looks up symbol.
+
+  /// Skip blanks.
+  void skip() {
+    while (p_ != e_ && (*p_ == ' ' || *p_ == '\t')) { ++p_; }
+  }
+
+  /// True if character be first character of symbol.
+  /// @param c  Character.
+  static bool sym_beg(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+  }
+
+  /// True if character be non-first character of symbol.
+  /// @param c  Character.
+  static bool sym_mid(char c) { return sym_beg(c) || (c >= '0' && c <= '9'); }
+
+  /// True if character be first character of number.
+  /// @param c  Character.
+  static bool num_beg(char c) { return (c >= '0' && c <= '9') || c == '.'; }
+
+  /// Parse (possibly signed) integer.
+  long integer() {
+    char *end = nullptr;
+    long  i   = std::strtol(p_, &end, 10);
+    if (end == p_ || end > e_) { error("expected integer in unit"); }
+    p_ = end;
+    return i;
+  }
+
+  /// Parse exponent, either integer or bracketed rational like "[-1/2]".
+  dim::rat exponent() {
+    skip();
+    if (p_ != e_ && *p_ == '[') {
+      ++p_;
+      long const n = integer();
+      long       d = 1;
+      if (p_ != e_ && *p_ == '/') {
+        ++p_;
+        d = integer();
+      }
+      if (p_ == e_ || *p_ != ']') { error("expected ']' in unit"); }
+      ++p_;
+      return dim::rat(n, d);
+    }
+    return dim::rat(integer());
+  }
+
+  /// Parse number, symbol, or parenthesized expression.
+  unit_spec primary() {
+    skip();
+    if (p_ == e_) { error("unexpected end of unit"); }
+    if (*p_ == '(') {
+      ++p_;
+      unit_spec const u = expr();
+      if (p_ == e_ || *p_ != ')') { error("expected ')' in unit"); }
+      ++p_;
+      return u;
+    }
+    if (num_beg(*p_)) {
+      char *            end = nullptr;
+      long double const x   = std::strtold(p_, &end);
+      if (end == p_ || end > e_) { error("bad number in unit"); }
+      p_ = end;
+      return {x, nul_dim};
+    }
+    if (sym_beg(*p_)) {
+      char const *const b = p_;
+      while (p_ != e_ && sym_mid(*p_)) { ++p_; }
+      return lookup_(b, p_ - b);
+    }
+    error("unexpected character in unit");
+    return {1, nul_dim};
+  }
+
+  /// Parse primary optionally raised to power.
+  unit_spec power() {
+    unit_spec const u = primary();
+    skip();
+    if (p_ != e_ && *p_ == '^') {
+      ++p_;
+      return u.pow(exponent());
+    }
+    return u;
+  }
+
+public:
+  /// Initialize from null-terminated range of characters.
+  /// @param b  Pointer to first character.
+  /// @param e  Pointer past last character, which must be null.
+  /// @param l  Function that looks up symbol.
+  unit_parser(char const *b, char const *e, L const &l)
+      : p_(b), e_(e), lookup_(l) {}
+
+  /// Parse product and quotient of powers.
+  unit_spec expr() {
+    unit_spec u = power();
+    for (;;) {
+      skip();
+      if (p_ == e_ || *p_ == ')') { return u; }
+      if (*p_ == '*') {
+        ++p_;
+        u = u * power();
+      } else if (*p_ == '/') {
+        ++p_;
+        u = u / power();
+      } else {
+        u = u * power();
+      }
+    }
+  }
+
+  /// True if every character has been consumed.
+  bool done() const { return p_ == e_; }
+};
+
+
+} // namespace impl
+
+
+/// Parse expression of unit, such as "km/s", "kg*m/s^2", or "m g s^-2".
+///
+/// An empty expression is the dimensionless unit, 1.  This will throw an
+/// exception if the expression be malformed or contain an unknown symbol.
+///
+/// @tparam L  Type of function-object that looks up symbol.
+/// @param  s  Expression.
+/// @param  l  Function that looks up symbol and returns unit_spec.
+/// @return    Scale-factor and dimension.
+template <typename L> unit_spec parse_unit(std::string const &s, L const &l) {
+  char const *const b = s.c_str();
+  char const *const e = b + s.size();
+  char const *      p = b;
+  while (p != e && (*p == ' ' || *p == '\t')) { ++p; }
+  if (p == e) { return {1, nul_dim}; }
+  impl::unit_parser<L> parser(b, e, l);
+  unit_spec const      u = parser.expr();
+  if (!parser.done()) { error("unbalanced ')' in unit"); }
+  return u;
+}
+
+
+/// Parse expression of unit, looking up each symbol in unit_syms.
+/// @param s  Expression.
+/// @return   Scale-factor and dimension.
+inline unit_spec parse_unit(std::string const &s) {
+  return parse_unit(s, unit_syms_lookup());
+}
+
+
+} // namespace units
+} // namespace vnix
+
+#endif // ndef VNIX_UNITS_UNIT_EXPR_HPP